@@ -15,6 +15,9 @@ namespace L0 {
 
 CommandList::~CommandList() {
     if (cmdQImmediate) {
+        if (immediateSubmissionPending) {
+            cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+        }
         cmdQImmediate->destroy();
     }
     removeDeallocationContainerData();
@@ -109,6 +112,22 @@ bool CommandList::isCopyOnly() const {
     return isCopyOnlyCmdList;
 }
 
+ze_result_t CommandList::hostSynchronize(uint64_t timeout) {
+    if (cmdListType != CommandListType::TYPE_IMMEDIATE) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!immediateSubmissionPending) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto ret = cmdQImmediate->synchronize(timeout);
+    if (ret == ZE_RESULT_SUCCESS) {
+        immediateSubmissionPending = false;
+        this->reset();
+    }
+    return ret;
+}
+
 NEO::PreemptionMode CommandList::obtainFunctionPreemptionMode(Kernel *kernel) {
     auto functionAttributes = kernel->getImmutableData()->getDescriptor().kernelAttributes;
     NEO::PreemptionFlags flags = {};
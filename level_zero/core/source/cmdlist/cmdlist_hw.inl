@@ -75,6 +75,24 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmediate(bo
     this->close();
     ze_command_list_handle_t immediateHandle = this->toHandle();
     this->cmdQImmediate->executeCommandLists(1, &immediateHandle, nullptr, performMigration);
+
+    if (this->asyncImmediateSubmission) {
+        this->immediateSubmissionPending = true;
+
+        // recorded commands stay in place until GPU completes them, so the next append is
+        // encoded after this one; wait and rewind only when the command buffer is used up
+        // or there are allocations which can be released only after completion
+        auto cmdBufferExhausted = (commandContainer.getCmdBufferAllocations().size() > 1) ||
+                                  (commandContainer.getCommandStream()->getAvailableSpace() < NEO::CommandContainer::defaultListCmdBufferSize / 2);
+        if (!cmdBufferExhausted && commandContainer.getDeallocationContainer().empty()) {
+            this->printfFunctionContainer.clear();
+            commandContainer.continueAfterSubmission();
+            programStateBaseAddress(commandContainer);
+            return ZE_RESULT_SUCCESS;
+        }
+        this->immediateSubmissionPending = false;
+    }
+
     this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
     this->reset();
 
@@ -740,7 +758,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                                                       NEO::GraphicsAllocation *srcptr,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
 
     auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
 
@@ -757,8 +775,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
-    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress());
-    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress());
+    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress() + offset);
+    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress() + offset);
 
     builtinFunction->setArgBufferWithAlloc(0, dstValPtr, dstptr);
     builtinFunction->setArgBufferWithAlloc(1, srcValPtr, srcptr);
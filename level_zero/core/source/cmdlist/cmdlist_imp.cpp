@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
@@ -113,6 +114,10 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         commandList->cmdQImmediate = commandQueue;
         commandList->cmdListType = CommandListType::TYPE_IMMEDIATE;
         commandList->commandListPreemptionMode = device->getDevicePreemptionMode();
+        commandList->asyncImmediateSubmission = (desc->mode == ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+        if (desc->mode == ZE_COMMAND_QUEUE_MODE_DEFAULT && NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.get() != -1) {
+            commandList->asyncImmediateSubmission = !!NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.get();
+        }
         return commandList;
     }
 
@@ -19,6 +19,8 @@
 #include "hw_helpers.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -57,7 +59,7 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
                                  commandStream->getUsed(), commandStream, endingCmdPtr);
 
     csr->submitBatchBuffer(batchBuffer, residencyContainer);
-    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp());
+    buffers.setCurrentFlushStamp(csr->peekTaskCount(), csr->obtainCurrentFlushStamp());
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
@@ -75,7 +77,7 @@ ze_result_t CommandQueueImp::synchronizeByPollingForTaskCount(uint64_t timeout)
         timeoutMicroseconds = NEO::TimeoutControls::maxTimeout;
     }
 
-    csr->waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, this->taskCount);
+    csr->waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, this->taskCount, buffers.getCurrentFlushStamp());
 
     if (*csr->getTagAddress() < taskCountToWait) {
         return ZE_RESULT_NOT_READY;
@@ -119,43 +121,78 @@ ze_command_queue_mode_t CommandQueueImp::getSynchronousMode() {
 }
 
 void CommandQueueImp::CommandBufferManager::initialize(Device *device, size_t sizeRequested) {
-    size_t alignedSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
-    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, alignedSize,
+    this->device = device;
+    this->bufferSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
+    if (NEO::DebugManager.flags.CommandQueueMaxCmdBuffers.get() != -1) {
+        maxBufferCount = std::max(static_cast<size_t>(initialBufferCount), static_cast<size_t>(NEO::DebugManager.flags.CommandQueueMaxCmdBuffers.get()));
+    }
+
+    for (size_t i = 0; i < initialBufferCount; i++) {
+        auto buffer = allocateBuffer();
+        UNRECOVERABLE_IF(nullptr == buffer);
+        buffers.push_back(buffer);
+    }
+    flushId.assign(initialBufferCount, 0u);
+    completionTaskCount.assign(initialBufferCount, 0u);
+    bufferUse = 0u;
+}
+
+NEO::GraphicsAllocation *CommandQueueImp::CommandBufferManager::allocateBuffer() {
+    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, bufferSize,
                                          NEO::GraphicsAllocation::AllocationType::COMMAND_BUFFER,
                                          device->isMultiDeviceCapable(),
                                          false,
                                          CommonConstants::allDevicesBitfield};
 
-    buffers[BUFFER_ALLOCATION::FIRST] = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
-
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::FIRST]);
-    memset(buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBufferSize());
+    auto buffer = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    if (buffer) {
+        memset(buffer->getUnderlyingBuffer(), 0, buffer->getUnderlyingBufferSize());
+    }
+    return buffer;
+}
 
-    buffers[BUFFER_ALLOCATION::SECOND] = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+void CommandQueueImp::CommandBufferManager::destroy(NEO::MemoryManager *memoryManager) {
+    NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stdout,
+                          "Command queue buffer ring: %zu of %zu buffers used, %u stalls\n", buffers.size(), maxBufferCount, stallCount);
 
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::SECOND]);
-    memset(buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBufferSize());
-    flushId[BUFFER_ALLOCATION::FIRST] = 0u;
-    flushId[BUFFER_ALLOCATION::SECOND] = 0u;
+    for (auto buffer : buffers) {
+        memoryManager->freeGraphicsMemory(buffer);
+    }
+    buffers.clear();
+    flushId.clear();
+    completionTaskCount.clear();
 }
 
-void CommandQueueImp::CommandBufferManager::destroy(NEO::MemoryManager *memoryManager) {
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::FIRST]);
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::SECOND]);
+bool CommandQueueImp::CommandBufferManager::isBufferCompleted(size_t bufferIndex, NEO::CommandStreamReceiver *csr) const {
+    if (flushId[bufferIndex] == 0u) {
+        return true;
+    }
+    UNRECOVERABLE_IF(csr == nullptr);
+    return *csr->getTagAddress() >= completionTaskCount[bufferIndex];
 }
 
 void CommandQueueImp::CommandBufferManager::switchBuffers(NEO::CommandStreamReceiver *csr) {
-    if (bufferUse == BUFFER_ALLOCATION::FIRST) {
-        bufferUse = BUFFER_ALLOCATION::SECOND;
-    } else {
-        bufferUse = BUFFER_ALLOCATION::FIRST;
+    auto nextBuffer = (bufferUse + 1) % buffers.size();
+
+    if (!isBufferCompleted(nextBuffer, csr) && buffers.size() < maxBufferCount) {
+        auto newBuffer = allocateBuffer();
+        if (newBuffer) {
+            // keep ring order, the oldest submission stays next in line
+            nextBuffer = bufferUse + 1;
+            buffers.insert(buffers.begin() + nextBuffer, newBuffer);
+            flushId.insert(flushId.begin() + nextBuffer, 0u);
+            completionTaskCount.insert(completionTaskCount.begin() + nextBuffer, 0u);
+        }
     }
 
-    NEO::FlushStamp completionId = flushId[bufferUse];
-    if (completionId != 0u) {
-        UNRECOVERABLE_IF(csr == nullptr);
-        csr->waitForFlushStamp(completionId);
+    bufferUse = nextBuffer;
+
+    if (!isBufferCompleted(bufferUse, csr)) {
+        stallCount++;
+        csr->waitForFlushStamp(flushId[bufferUse]);
     }
+    flushId[bufferUse] = 0u;
+    completionTaskCount[bufferUse] = 0u;
 }
 
 } // namespace L0
@@ -21,6 +21,7 @@
 #include "shared/source/helpers/preamble.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/residency_container.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
@@ -36,6 +37,7 @@
 
 #include <limits>
 #include <thread>
+#include <unordered_set>
 
 namespace L0 {
 
@@ -110,6 +112,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     bool directSubmissionEnabled = csr->isDirectSubmissionEnabled();
 
     NEO::ResidencyContainer residencyContainer;
+    std::vector<std::shared_ptr<const NEO::SVMAllocsManager::IndirectResidencySnapshot>> indirectResidencySnapshots;
     L0::Fence *fence = nullptr;
 
     device->activateMetricGroups();
@@ -123,12 +126,16 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             UnifiedMemoryControls unifiedMemoryControls = commandList->getUnifiedMemoryControls();
 
             auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
-            svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
-                                                                         commandList->commandContainer.getResidencyContainer(),
-                                                                         unifiedMemoryControls.generateMask());
+            auto indirectResidency = svmAllocsManager->getIndirectResidencySnapshot(neoDevice->getRootDeviceIndex(),
+                                                                                    unifiedMemoryControls.generateMask());
+            if (indirectResidencySnapshots.end() ==
+                std::find(indirectResidencySnapshots.begin(), indirectResidencySnapshots.end(), indirectResidency)) {
+                spaceForResidency += indirectResidency->allocations.size();
+                indirectResidencySnapshots.push_back(std::move(indirectResidency));
+            }
         }
 
-        totalCmdBuffers += commandList->commandContainer.getCmdBufferAllocations().size();
+        totalCmdBuffers += commandList->commandContainer.getCmdBufferAllocations().size() - commandList->commandContainer.getSubmissionStartCmdBufferIndex();
         spaceForResidency += commandList->commandContainer.getResidencyContainer().size();
         auto commandListPreemption = commandList->getCommandListPreemptionMode();
         if (statePreemption != commandListPreemption) {
@@ -255,6 +262,24 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             residencyContainer.push_back(device->getDebugSurface());
         }
     }
+    NEO::PageFaultManager *pageFaultManager = nullptr;
+    if (performMigration) {
+        pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager == nullptr) {
+            performMigration = false;
+        }
+    }
+
+    auto migrateSharedAllocation = [&](NEO::GraphicsAllocation *alloc) {
+        if (performMigration) {
+            if (alloc &&
+                (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+                 alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+            }
+        }
+    };
+
     for (auto i = 0u; i < numCommandLists; ++i) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
         auto cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
@@ -271,34 +296,36 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             statePreemption = commandListPreemption;
         }
 
-        for (size_t iter = 0; iter < cmdBufferCount; iter++) {
+        auto firstCmdBuffer = commandList->commandContainer.getSubmissionStartCmdBufferIndex();
+        for (size_t iter = firstCmdBuffer; iter < cmdBufferCount; iter++) {
             auto allocation = cmdBufferAllocations[iter];
-            NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&child, allocation->getGpuAddress(), true);
+            auto startAddress = allocation->getGpuAddress();
+            if (iter == firstCmdBuffer) {
+                startAddress += commandList->commandContainer.getSubmissionStartOffset();
+            }
+            NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&child, startAddress, true);
         }
 
         printfFunctionContainer.insert(printfFunctionContainer.end(),
                                        commandList->getPrintfFunctionContainer().begin(),
                                        commandList->getPrintfFunctionContainer().end());
 
-        NEO::PageFaultManager *pageFaultManager = nullptr;
-        if (performMigration) {
-            pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
-            if (pageFaultManager == nullptr) {
-                performMigration = false;
-            }
-        }
-
         for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
             if (residencyContainer.end() ==
                 std::find(residencyContainer.begin(), residencyContainer.end(), alloc)) {
                 residencyContainer.push_back(alloc);
+                migrateSharedAllocation(alloc);
+            }
+        }
+    }
 
-                if (performMigration) {
-                    if (alloc &&
-                        (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
-                         alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
-                        pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
-                    }
+    if (!indirectResidencySnapshots.empty()) {
+        std::unordered_set<NEO::GraphicsAllocation *> addedAllocations(residencyContainer.begin(), residencyContainer.end());
+        for (auto &indirectResidency : indirectResidencySnapshots) {
+            for (auto alloc : indirectResidency->allocations) {
+                if (addedAllocations.insert(alloc).second) {
+                    residencyContainer.push_back(alloc);
+                    migrateSharedAllocation(alloc);
                 }
             }
         }
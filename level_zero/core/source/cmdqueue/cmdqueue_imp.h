@@ -28,11 +28,8 @@ struct Kernel;
 struct CommandQueueImp : public CommandQueue {
     class CommandBufferManager {
       public:
-        enum BUFFER_ALLOCATION : uint32_t {
-            FIRST = 0,
-            SECOND,
-            COUNT
-        };
+        static constexpr size_t initialBufferCount = 2u;
+        static constexpr size_t defaultMaxBufferCount = 8u;
 
         void initialize(Device *device, size_t sizeRequested);
         void destroy(NEO::MemoryManager *memoryManager);
@@ -42,14 +39,31 @@ struct CommandQueueImp : public CommandQueue {
             return buffers[bufferUse];
         }
 
-        void setCurrentFlushStamp(NEO::FlushStamp flushStamp) {
+        void setCurrentFlushStamp(uint32_t taskCount, NEO::FlushStamp flushStamp) {
+            completionTaskCount[bufferUse] = taskCount;
             flushId[bufferUse] = flushStamp;
         }
 
+        NEO::FlushStamp getCurrentFlushStamp() const {
+            return flushId[bufferUse];
+        }
+
+        size_t getBufferCount() const { return buffers.size(); }
+        size_t getMaxBufferCount() const { return maxBufferCount; }
+        uint32_t getStallCount() const { return stallCount; }
+
       private:
-        NEO::GraphicsAllocation *buffers[BUFFER_ALLOCATION::COUNT];
-        NEO::FlushStamp flushId[BUFFER_ALLOCATION::COUNT];
-        BUFFER_ALLOCATION bufferUse = BUFFER_ALLOCATION::FIRST;
+        NEO::GraphicsAllocation *allocateBuffer();
+        bool isBufferCompleted(size_t bufferIndex, NEO::CommandStreamReceiver *csr) const;
+
+        Device *device = nullptr;
+        size_t bufferSize = 0u;
+        size_t maxBufferCount = defaultMaxBufferCount;
+        std::vector<NEO::GraphicsAllocation *> buffers;
+        std::vector<NEO::FlushStamp> flushId;
+        std::vector<uint32_t> completionTaskCount;
+        size_t bufferUse = 0u;
+        uint32_t stallCount = 0u;
     };
     static constexpr size_t defaultQueueCmdBufferSize = 128 * MemoryConstants::kiloByte;
     static constexpr size_t minCmdBufferPtrAlign = 8;
@@ -9,6 +9,7 @@
 
 #include "level_zero/core/source/compiler_interface/default_l0_cache_config.h"
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
 #include "level_zero/core/source/compiler_interface/l0_reg_path.h"
@@ -27,6 +28,21 @@ NEO::CompilerCacheConfig getDefaultL0CompilerCacheConfig() {
 
     ret.cacheFileExtension = ".l0_c_cache";
 
+    keyName = registryPath;
+    keyName += "l0_c_cache_max_size";
+    settingsReader.reset(NEO::SettingsReader::createOsReader(false, keyName));
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<int64_t>(0)));
+
+    keyName = registryPath;
+    keyName += "l0_c_cache_in_memory_size";
+    settingsReader.reset(NEO::SettingsReader::createOsReader(false, keyName));
+    ret.inMemoryCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<int64_t>(32 * MemoryConstants::megaByte)));
+
+    keyName = registryPath;
+    keyName += "l0_c_cache_map_binaries";
+    settingsReader.reset(NEO::SettingsReader::createOsReader(false, keyName));
+    ret.mapCachedBinaries = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), true);
+
     return ret;
 }
 } // namespace L0
@@ -133,6 +133,9 @@ ze_result_t DriverHandleImp::getMemAllocProperties(const void *ptr,
 }
 
 DriverHandleImp::~DriverHandleImp() {
+    if (this->svmAllocsManager) {
+        this->svmAllocsManager->releaseUsmReusePool();
+    }
     for (auto &device : this->devices) {
         if (device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->debugger.get() &&
             !device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->debugger->isLegacy()) {
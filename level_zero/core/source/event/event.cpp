@@ -18,6 +18,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/wait_policy.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -177,10 +178,6 @@ ze_result_t EventImp::hostSignal() {
 }
 
 ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
-    std::chrono::high_resolution_clock::time_point time1, time2;
-    uint64_t timeDiff = 0;
-    ze_result_t ret = ZE_RESULT_NOT_READY;
-
     if (this->csr->getType() == NEO::CommandStreamReceiverType::CSR_AUB) {
         return ZE_RESULT_SUCCESS;
     }
@@ -189,29 +186,20 @@ ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
         return queryStatus();
     }
 
-    time1 = std::chrono::high_resolution_clock::now();
-    while (true) {
-        ret = queryStatus();
-        if (ret == ZE_RESULT_SUCCESS) {
-            return ZE_RESULT_SUCCESS;
-        }
-
-        std::this_thread::yield();
-        NEO::CpuIntrinsics::pause();
-
-        if (timeout == std::numeric_limits<uint32_t>::max()) {
-            continue;
-        }
-
-        time2 = std::chrono::high_resolution_clock::now();
-        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
+    bool enableTimeout = (timeout != std::numeric_limits<uint32_t>::max()) && (timeout != std::numeric_limits<uint64_t>::max());
+    int64_t timeoutMicroseconds = enableTimeout ? static_cast<int64_t>(timeout / 1000u) : 0;
 
-        if (timeDiff >= timeout) {
-            break;
+    // submission signaling the event is not known, so block until the latest submission of the event's CSR
+    // completes; if the event is signaled by other work, polling continues afterwards
+    auto blockingWait = [this]() {
+        if (*csr->getTagAddress() < csr->peekLatestFlushedTaskCount()) {
+            auto flushStampToWait = csr->obtainCurrentFlushStamp();
+            csr->waitForFlushStamp(flushStampToWait);
         }
-    }
+    };
+    auto completed = csr->getWaitPolicy().wait([this]() { return queryStatus() == ZE_RESULT_SUCCESS; }, blockingWait, enableTimeout, timeoutMicroseconds);
 
-    return ret;
+    return completed ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
 }
 
 ze_result_t EventImp::reset() {
@@ -272,7 +272,7 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
 
         if (numChannels > 0) {
             UNRECOVERABLE_IF(3 != numChannels);
-            NEO::generateLocalIDs(
+            localIdsCache.setLocalIdsForGroup(
                 perThreadDataForWholeThreadGroup,
                 static_cast<uint16_t>(simdSize),
                 std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
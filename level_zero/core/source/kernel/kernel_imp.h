@@ -10,6 +10,8 @@
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
+#include "opencl/source/command_queue/local_ids_cache.h"
+
 #include "level_zero/core/source/kernel/kernel.h"
 
 #include <memory>
@@ -143,6 +145,7 @@ struct KernelImp : Kernel {
     uint32_t perThreadDataSizeForWholeThreadGroupAllocated = 0;
     uint32_t perThreadDataSizeForWholeThreadGroup = 0u;
     uint32_t perThreadDataSize = 0u;
+    NEO::LocalIdsCache localIdsCache;
 
     UnifiedMemoryControls unifiedMemoryControls;
     std::vector<uint32_t> slmArgSizes;
@@ -13,7 +13,7 @@
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 namespace NEO {
-void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
+void PageFaultManager::transferToCpu(void *ptr, size_t offset, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
@@ -22,10 +22,10 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
                                                              allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+                                                             offset, size, true);
     UNRECOVERABLE_IF(ret);
 }
-void PageFaultManager::transferToGpu(void *ptr, void *device) {
+void PageFaultManager::transferToGpu(void *ptr, size_t offset, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
@@ -34,7 +34,7 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
                                                              allocData->cpuAllocation,
-                                                             allocData->size, false);
+                                                             offset, size, false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
@@ -95,6 +95,8 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
     inputArgs.specializedValues = this->specConstantsValues;
+    // cached binaries carry no debug data, so modules built for the debugger always go through the compiler
+    inputArgs.allowCaching = (false == device->getNEODevice()->getDeviceInfo().debuggerActive);
     NEO::TranslationOutput compilerOuput = {};
     auto compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
@@ -64,9 +64,11 @@ struct MockCompilerInterface : public NEO::CompilerInterface {
     NEO::TranslationOutput::ErrorCode build(const NEO::Device &device,
                                             const NEO::TranslationInput &input,
                                             NEO::TranslationOutput &output) override {
-
+        receivedAllowCaching = input.allowCaching;
         return NEO::TranslationOutput::ErrorCode::Success;
     }
+
+    bool receivedAllowCaching = false;
 };
 
 struct MockCompilerInterfaceWithSpecConstants : public NEO::CompilerInterface {
@@ -91,7 +93,8 @@ struct MockCompilerInterfaceWithSpecConstants : public NEO::CompilerInterface {
     }
 
     NEO::TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device,
-                                                           ArrayRef<const char> srcSpirV, NEO::SpecConstantInfo &output) override {
+                                                           ArrayRef<const char> srcSpirV, NEO::SpecConstantInfo &output,
+                                                           bool allowCaching) override {
         output.idsBuffer.reset(new NEO::MockCIFBuffer());
         for (uint32_t i = 0; i < moduleNumSpecConstants; i++) {
             output.idsBuffer->PushBackRawCopy(moduleSpecConstantsIds[i]);
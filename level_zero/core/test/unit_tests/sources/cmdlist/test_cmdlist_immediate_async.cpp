@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/mocks/mock_command_stream_receiver.h"
+
+#include "test.h"
+
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+template <typename GfxFamily>
+struct MockCsrWithGpuLatency : public MockCsrHw2<GfxFamily> {
+    using MockCsrHw2<GfxFamily>::MockCsrHw2;
+
+    bool flush(NEO::BatchBuffer &batchBuffer, NEO::ResidencyContainer &allocationsForResidency) override {
+        gpuIdleTime = std::max(gpuIdleTime, std::chrono::steady_clock::now()) + gpuTimePerSubmission;
+        return MockCsrHw2<GfxFamily>::flush(batchBuffer, allocationsForResidency);
+    }
+
+    bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait, FlushStamp flushStampToWait) override {
+        waitForCompletionCalled++;
+        std::this_thread::sleep_until(gpuIdleTime);
+        *this->getTagAddress() = taskCountToWait;
+        return true;
+    }
+
+    std::chrono::steady_clock::time_point gpuIdleTime = {};
+    std::chrono::microseconds gpuTimePerSubmission{0};
+    uint32_t waitForCompletionCalled = 0u;
+};
+
+struct CommandListImmediateAsyncFixture : public DeviceFixture {
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>> createImmediateCommandList(NEO::CommandStreamReceiver &csr, ze_command_queue_mode_t mode) {
+        ze_command_queue_desc_t desc = {};
+        desc.mode = mode;
+
+        auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>>();
+        commandList->initialize(device, false);
+        commandList->cmdQImmediate = CommandQueue::create(productFamily, device, &csr, &desc, false);
+        commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+        commandList->asyncImmediateSubmission = (mode == ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+        return commandList;
+    }
+
+    template <typename FamilyType>
+    std::unique_ptr<MockCsrWithGpuLatency<FamilyType>> createCsr() {
+        auto csr = std::make_unique<MockCsrWithGpuLatency<FamilyType>>(*neoDevice->getExecutionEnvironment(), 0);
+        csr->initializeTagAllocation();
+        csr->setupContext(*neoDevice->getDefaultEngine().osContext);
+        return csr;
+    }
+};
+
+using CommandListImmediateAsync = Test<CommandListImmediateAsyncFixture>;
+using Platforms = IsAtLeastProduct<IGFX_SKYLAKE>;
+
+TEST_F(CommandListImmediateAsync, givenAsynchronousQueueModeWhenCreatingImmediateCommandListThenAsyncSubmissionIsEnabled) {
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_TRUE(commandList->isAsyncImmediate());
+
+    desc.mode = ZE_COMMAND_QUEUE_MODE_DEFAULT;
+    std::unique_ptr<L0::CommandList> commandListDefault(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandListDefault);
+    EXPECT_FALSE(commandListDefault->isAsyncImmediate());
+}
+
+TEST_F(CommandListImmediateAsync, givenAsyncImmediateCommandListsEnabledWhenCreatingDefaultModeImmediateCommandListThenAsyncSubmissionIsEnabled) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_DEFAULT;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_TRUE(commandList->isAsyncImmediate());
+}
+
+TEST_F(CommandListImmediateAsync, givenAsyncImmediateCommandListsEnabledWhenCreatingSynchronousImmediateCommandListThenAsyncSubmissionIsDisabled) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_FALSE(commandList->isAsyncImmediate());
+}
+
+TEST_F(CommandListImmediateAsync, givenAsyncImmediateCommandListsDisabledWhenCreatingImmediateCommandListThenOnlyDefaultModeListIsAffected) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.set(0);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_DEFAULT;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandListDefault(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandListDefault);
+    EXPECT_FALSE(commandListDefault->isAsyncImmediate());
+
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    std::unique_ptr<L0::CommandList> commandListAsync(CommandList::createImmediate(productFamily, device, &desc, false, false, returnValue));
+    ASSERT_NE(nullptr, commandListAsync);
+    EXPECT_TRUE(commandListAsync->isAsyncImmediate());
+}
+
+TEST_F(CommandListImmediateAsync, givenRegularCommandListWhenCallingHostSynchronizeThenInvalidArgumentIsReturned) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, false, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+}
+
+HWTEST2_F(CommandListImmediateAsync, givenAsyncImmediateCommandListWhenAppendingThenQueueIsNotSynchronizedAndNextSubmissionStartsAfterPreviousCommands, Platforms) {
+    auto csr = createCsr<FamilyType>();
+    auto commandList = createImmediateCommandList<gfxCoreFamily>(*csr, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    auto &commandContainer = commandList->commandContainer;
+    auto initialCmdBuffer = commandContainer.getCmdBufferAllocations()[0];
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(0u, csr->waitForCompletionCalled);
+    EXPECT_TRUE(commandList->immediateSubmissionPending);
+    EXPECT_EQ(1u, csr->peekTaskCount());
+    EXPECT_EQ(0u, commandContainer.getSubmissionStartCmdBufferIndex());
+    auto firstSubmissionEnd = commandContainer.getSubmissionStartOffset();
+    EXPECT_NE(0u, firstSubmissionEnd);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(0u, csr->waitForCompletionCalled);
+    EXPECT_EQ(2u, csr->peekTaskCount());
+    EXPECT_LT(firstSubmissionEnd, commandContainer.getSubmissionStartOffset());
+
+    EXPECT_EQ(1u, commandContainer.getCmdBufferAllocations().size());
+    EXPECT_EQ(initialCmdBuffer, commandContainer.getCmdBufferAllocations()[0]);
+    auto &residencyContainer = commandContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), initialCmdBuffer));
+}
+
+HWTEST2_F(CommandListImmediateAsync, givenPendingSubmissionsWhenHostSynchronizeIsCalledThenQueueIsSynchronizedOnceAndCommandListIsRewound, Platforms) {
+    auto csr = createCsr<FamilyType>();
+    auto commandList = createImmediateCommandList<gfxCoreFamily>(*csr, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(0u, csr->waitForCompletionCalled);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1u, csr->waitForCompletionCalled);
+    EXPECT_FALSE(commandList->immediateSubmissionPending);
+    EXPECT_EQ(0u, commandList->commandContainer.getSubmissionStartOffset());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1u, csr->waitForCompletionCalled);
+}
+
+HWTEST2_F(CommandListImmediateAsync, givenAsyncImmediateCommandListWhenCommandBufferIsExhaustedThenQueueIsSynchronizedAndCommandBuffersAreRecycled, Platforms) {
+    auto csr = createCsr<FamilyType>();
+    auto commandList = createImmediateCommandList<gfxCoreFamily>(*csr, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    auto &commandContainer = commandList->commandContainer;
+
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    commandContainer.allocateNextCommandBuffer();
+    EXPECT_EQ(2u, commandContainer.getCmdBufferAllocations().size());
+
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(1u, csr->waitForCompletionCalled);
+    EXPECT_FALSE(commandList->immediateSubmissionPending);
+    EXPECT_EQ(1u, commandContainer.getCmdBufferAllocations().size());
+    EXPECT_EQ(0u, commandContainer.getSubmissionStartCmdBufferIndex());
+    EXPECT_EQ(0u, commandContainer.getSubmissionStartOffset());
+    EXPECT_EQ(commandContainer.getCmdBufferAllocations()[0], commandContainer.getCommandStream()->getGraphicsAllocation());
+}
+
+HWTEST2_F(CommandListImmediateAsync, givenSynchronousImmediateCommandListWhenAppendingThenQueueIsSynchronizedAfterEveryAppend, Platforms) {
+    auto csr = createCsr<FamilyType>();
+    auto commandList = createImmediateCommandList<gfxCoreFamily>(*csr, ZE_COMMAND_QUEUE_MODE_DEFAULT);
+
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(2u, csr->waitForCompletionCalled);
+    EXPECT_FALSE(commandList->immediateSubmissionPending);
+    EXPECT_EQ(0u, commandList->commandContainer.getSubmissionStartOffset());
+}
+
+HWTEST2_F(CommandListImmediateAsync, DISABLED_profilingAppendLatencyAndThroughputOfSynchronousAndAsyncImmediateCommandLists, Platforms) {
+    constexpr size_t appendCount = 2000u;
+    constexpr std::chrono::microseconds gpuTimePerSubmission{20};
+
+    for (auto mode : {ZE_COMMAND_QUEUE_MODE_DEFAULT, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS}) {
+        auto csr = createCsr<FamilyType>();
+        csr->gpuTimePerSubmission = gpuTimePerSubmission;
+        auto commandList = createImmediateCommandList<gfxCoreFamily>(*csr, mode);
+
+        std::chrono::nanoseconds appendTime{0};
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < appendCount; i++) {
+            auto appendStart = std::chrono::steady_clock::now();
+            commandList->appendBarrier(nullptr, 0, nullptr);
+            appendTime += std::chrono::steady_clock::now() - appendStart;
+        }
+        commandList->hostSynchronize(std::numeric_limits<uint64_t>::max());
+        auto totalTime = std::chrono::steady_clock::now() - start;
+
+        auto totalUs = std::chrono::duration_cast<std::chrono::microseconds>(totalTime).count();
+        printf("\n%s: avg append latency %lld ns, %zu appends in %lld us (%.1f appends/ms), %u waits",
+               mode == ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS ? "async" : "sync",
+               static_cast<long long>(appendTime.count() / appendCount),
+               appendCount, static_cast<long long>(totalUs),
+               totalUs ? static_cast<double>(appendCount) * 1000.0 / static_cast<double>(totalUs) : 0.0,
+               csr->waitForCompletionCalled);
+    }
+    printf("\n");
+}
+
+} // namespace ult
+} // namespace L0
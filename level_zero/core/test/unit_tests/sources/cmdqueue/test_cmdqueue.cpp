@@ -263,10 +263,66 @@ HWTEST_F(CommandQueueIndirectAllocations, givenCommandQueueWhenExecutingCommandL
     result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
-    itorEvent = std::find(std::begin(commandList->commandContainer.getResidencyContainer()),
-                          std::end(commandList->commandContainer.getResidencyContainer()),
+    itorEvent = std::find(std::begin(csr.copyOfAllocations),
+                          std::end(csr.copyOfAllocations),
                           gpuAlloc);
-    EXPECT_NE(itorEvent, std::end(commandList->commandContainer.getResidencyContainer()));
+    EXPECT_NE(itorEvent, std::end(csr.copyOfAllocations));
+
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueIndirectAllocations, givenCommandListWithIndirectAllocationsWhenExecutingItMultipleTimesThenResidencyContainersDoNotGrow) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, true, returnValue));
+
+    void *deviceAlloc = nullptr;
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &deviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto gpuAlloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(deviceAlloc)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, gpuAlloc);
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(),
+                                             &groupCount,
+                                             nullptr,
+                                             0,
+                                             nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto commandListHandle = commandList->toHandle();
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto commandListResidencySize = commandList->commandContainer.getResidencyContainer().size();
+    auto submittedResidencySize = csr.copyOfAllocations.size();
+    EXPECT_EQ(1, std::count(csr.copyOfAllocations.begin(), csr.copyOfAllocations.end(), gpuAlloc));
+
+    for (auto i = 0u; i < 3u; i++) {
+        result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+        EXPECT_EQ(commandListResidencySize, commandList->commandContainer.getResidencyContainer().size());
+        EXPECT_EQ(submittedResidencySize, csr.copyOfAllocations.size());
+        EXPECT_EQ(1, std::count(csr.copyOfAllocations.begin(), csr.copyOfAllocations.end(), gpuAlloc));
+    }
 
     device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
     commandQueue->destroy();
@@ -339,7 +395,7 @@ HWTEST_F(CommandQueueSynchronizeTest, givenCallToSynchronizeThenCorrectEnableTim
         SynchronizeCsr(const NEO::ExecutionEnvironment &executionEnvironment) : NEO::UltCommandStreamReceiver<FamilyType>(const_cast<NEO::ExecutionEnvironment &>(executionEnvironment), 0) {
             tagAddress = new uint32_t;
         }
-        bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMs, uint32_t taskCountToWait) override {
+        bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMs, uint32_t taskCountToWait, FlushStamp flushStampToWait) override {
             waitForComplitionCalledTimes++;
             return true;
         }
@@ -379,5 +435,68 @@ HWTEST_F(CommandQueueSynchronizeTest, givenCallToSynchronizeThenCorrectEnableTim
     L0::CommandQueue::fromHandle(commandQueue)->destroy();
 }
 
+using CommandQueueCommandBuffers = Test<DeviceFixture>;
+HWTEST_F(CommandQueueCommandBuffers, givenSubmittedBuffersNotCompletedWhenSwitchingBuffersThenRingGrowsUpToMaxCountAndThenWaitsForOldestBuffer) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.CommandQueueMaxCmdBuffers.set(3);
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    *csr.getTagAddress() = 0u;
+
+    const size_t initialBufferCount = CommandQueueImp::CommandBufferManager::initialBufferCount;
+    CommandQueueImp::CommandBufferManager buffers;
+    buffers.initialize(device, CommandQueueImp::totalCmdBufferSize);
+    EXPECT_EQ(initialBufferCount, buffers.getBufferCount());
+    EXPECT_EQ(3u, buffers.getMaxBufferCount());
+
+    auto firstBuffer = buffers.getCurrentBufferAllocation();
+    buffers.setCurrentFlushStamp(1u, 1u);
+    buffers.switchBuffers(&csr);
+    auto secondBuffer = buffers.getCurrentBufferAllocation();
+    EXPECT_NE(firstBuffer, secondBuffer);
+    EXPECT_EQ(2u, buffers.getBufferCount());
+
+    buffers.setCurrentFlushStamp(2u, 2u);
+    buffers.switchBuffers(&csr);
+    auto thirdBuffer = buffers.getCurrentBufferAllocation();
+    EXPECT_NE(firstBuffer, thirdBuffer);
+    EXPECT_NE(secondBuffer, thirdBuffer);
+    EXPECT_EQ(3u, buffers.getBufferCount());
+    EXPECT_EQ(0u, buffers.getStallCount());
+
+    buffers.setCurrentFlushStamp(3u, 3u);
+    buffers.switchBuffers(&csr);
+    EXPECT_EQ(firstBuffer, buffers.getCurrentBufferAllocation());
+    EXPECT_EQ(3u, buffers.getBufferCount());
+    EXPECT_EQ(1u, buffers.getStallCount());
+
+    buffers.destroy(neoDevice->getMemoryManager());
+}
+
+HWTEST_F(CommandQueueCommandBuffers, givenSubmittedBufferCompletedWhenSwitchingBuffersThenBufferIsReusedWithoutGrowingOrStalling) {
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+
+    const size_t initialBufferCount = CommandQueueImp::CommandBufferManager::initialBufferCount;
+    const size_t defaultMaxBufferCount = CommandQueueImp::CommandBufferManager::defaultMaxBufferCount;
+    CommandQueueImp::CommandBufferManager buffers;
+    buffers.initialize(device, CommandQueueImp::totalCmdBufferSize);
+    EXPECT_EQ(defaultMaxBufferCount, buffers.getMaxBufferCount());
+
+    auto firstBuffer = buffers.getCurrentBufferAllocation();
+    for (uint32_t taskCount = 1u; taskCount <= 4u; taskCount++) {
+        buffers.setCurrentFlushStamp(taskCount, taskCount);
+        *csr.getTagAddress() = taskCount;
+        buffers.switchBuffers(&csr);
+    }
+
+    EXPECT_EQ(firstBuffer, buffers.getCurrentBufferAllocation());
+    EXPECT_EQ(initialBufferCount, buffers.getBufferCount());
+    EXPECT_EQ(0u, buffers.getStallCount());
+
+    buffers.destroy(neoDevice->getMemoryManager());
+}
+
 } // namespace ult
 } // namespace L0
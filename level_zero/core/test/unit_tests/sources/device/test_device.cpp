@@ -40,6 +40,23 @@ TEST(L0DeviceTest, GivenDualStorageSharedMemorySupportedWhenCreatingDeviceThenPa
     EXPECT_EQ(ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS, static_cast<CommandQueueImp *>(deviceImp->pageFaultCommandList->cmdQImmediate)->getSynchronousMode());
 }
 
+TEST(L0DeviceTest, GivenAsyncImmediateCommandListsEnabledWhenCreatingDeviceThenPageFaultCmdListImmediateIsSynchronous) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(1);
+    NEO::DebugManager.flags.EnableAsyncImmediateCommandLists.set(1);
+
+    std::unique_ptr<DriverHandleImp> driverHandle(new DriverHandleImp);
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrLocalMemory = true;
+    auto neoDevice = std::unique_ptr<NEO::Device>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+
+    auto device = std::unique_ptr<L0::Device>(Device::create(driverHandle.get(), neoDevice.release(), 1, false));
+    ASSERT_NE(nullptr, device);
+    auto deviceImp = static_cast<DeviceImp *>(device.get());
+    ASSERT_NE(nullptr, deviceImp->pageFaultCommandList);
+    EXPECT_FALSE(deviceImp->pageFaultCommandList->isAsyncImmediate());
+}
+
 struct DeviceTest : public ::testing::Test {
     void SetUp() override {
         DebugManager.flags.CreateMultipleRootDevices.set(numRootDevices);
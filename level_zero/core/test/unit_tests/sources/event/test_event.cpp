@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/mocks/mock_command_stream_receiver.h"
+
 #include "opencl/test/unit_test/mocks/mock_memory_operations_handler.h"
 #include "test.h"
 
@@ -115,6 +118,99 @@ TEST_F(EventCreate, givenAnEventCreateWithInvalidIndexUsingThisEventPoolThenErro
     ASSERT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, value);
 }
 
+struct EventHostSynchronizeCsr : public MockCommandStreamReceiver {
+    using MockCommandStreamReceiver::MockCommandStreamReceiver;
+
+    bool waitForFlushStamp(FlushStamp &flushStampToWait) override {
+        waitForFlushStampCalled++;
+        if (signalEventOnBlockingWait) {
+            eventToSignal->hostSignal();
+        }
+        return true;
+    }
+
+    void downloadAllocations() override {
+        if (++downloadAllocationsCalls == signalEventAfterQueries) {
+            eventToSignal->hostSignal();
+        }
+    }
+
+    L0::Event *eventToSignal = nullptr;
+    bool signalEventOnBlockingWait = false;
+    uint32_t signalEventAfterQueries = 0u;
+    uint32_t downloadAllocationsCalls = 0u;
+    uint32_t waitForFlushStampCalled = 0u;
+};
+
+struct EventHostSynchronizeTest : public Test<DeviceFixture> {
+    void SetUp() override {
+        DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+        DeviceFixture::SetUp();
+
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = 1;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+        eventPool.reset(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = 0;
+        eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+        eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+        event.reset(Event::create(eventPool.get(), &eventDesc, device));
+
+        csr = std::make_unique<EventHostSynchronizeCsr>(*neoDevice->getExecutionEnvironment(), 0);
+        csr->tagAddress = &tag;
+        csr->eventToSignal = event.get();
+        event->csr = csr.get();
+    }
+
+    void TearDown() override {
+        event.reset();
+        csr.reset();
+        eventPool.reset();
+        DeviceFixture::TearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<L0::EventPool> eventPool;
+    std::unique_ptr<L0::Event> event;
+    std::unique_ptr<EventHostSynchronizeCsr> csr;
+    volatile uint32_t tag = 0u;
+};
+
+TEST_F(EventHostSynchronizeTest, givenPendingCsrSubmissionWhenSynchronizingEventWithoutTimeoutThenBlockOnLatestSubmissionOfCsr) {
+    csr->latestFlushedTaskCount = 1u;
+    csr->signalEventOnBlockingWait = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1u, csr->waitForFlushStampCalled);
+}
+
+TEST_F(EventHostSynchronizeTest, givenEventNotSignaledByCsrSubmissionWhenSynchronizingEventWithoutTimeoutThenPollingContinuesAfterBlockingWait) {
+    csr->latestFlushedTaskCount = 1u;
+    csr->signalEventAfterQueries = 10u;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1u, csr->waitForFlushStampCalled);
+    EXPECT_EQ(10u, csr->downloadAllocationsCalls);
+}
+
+TEST_F(EventHostSynchronizeTest, givenNoPendingCsrSubmissionWhenSynchronizingEventWithoutTimeoutThenDontBlockAndPollUntilSignaled) {
+    tag = 1u;
+    csr->latestFlushedTaskCount = 1u;
+    csr->signalEventAfterQueries = 10u;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(0u, csr->waitForFlushStampCalled);
+}
+
+TEST_F(EventHostSynchronizeTest, givenPendingCsrSubmissionWhenSynchronizingEventWithTimeoutThenDontBlock) {
+    csr->latestFlushedTaskCount = 1u;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(1000u));
+    EXPECT_EQ(0u, csr->waitForFlushStampCalled);
+}
+
 TEST_F(EventPoolCreate, returnsSuccessFromCreateEventPoolWithNoDevice) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
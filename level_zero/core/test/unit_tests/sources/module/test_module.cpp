@@ -156,6 +156,21 @@ HWTEST_F(ModuleSpecConstantsTests, givenSpecializationConstantsSetInDescriptorTh
     module->destroy();
 }
 
+using ModuleBuildCachingTest = Test<DeviceFixture>;
+
+HWTEST_F(ModuleBuildCachingTest, givenSpirvModuleWhenBuildingThenCompilerCacheIsAllowed) {
+    auto mockCompiler = new MockCompilerInterface();
+    auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+    rootDeviceEnvironment->compilerInterface.reset(mockCompiler);
+
+    uint8_t spirvData{};
+    MockModuleTranslationUnit translationUnit(device);
+    bool success = translationUnit.buildFromSpirV(reinterpret_cast<const char *>(&spirvData), sizeof(spirvData), "", "", nullptr);
+
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(mockCompiler->receivedAllowCaching);
+}
+
 using ModuleLinkingTest = Test<DeviceFixture>;
 
 HWTEST_F(ModuleLinkingTest, givenFailureDuringLinkingWhenCreatingModuleThenModuleInitialiationFails) {
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_compression.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage " << argv[0] << " <compressed aub file> <output aub file>\n"
+                  << "Restores an AUB file written with AUBDumpCompression enabled" << std::endl;
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ifstream::binary);
+    if (!input.good()) {
+        std::cerr << "Cannot open input file " << argv[1] << std::endl;
+        return 1;
+    }
+    std::ofstream output(argv[2], std::ofstream::binary);
+    if (!output.good()) {
+        std::cerr << "Cannot open output file " << argv[2] << std::endl;
+        return 1;
+    }
+
+    if (!AubMemDump::AubCompression::decompressFile(input, output)) {
+        std::cerr << "Input file " << argv[1] << " is not a valid compressed AUB file" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace AubMemDump {
+namespace AubCompression {
+
+namespace {
+constexpr size_t minMatch = 4;
+constexpr size_t lastLiterals = 5;
+constexpr size_t matchSearchLimit = 12;
+constexpr size_t maxOffset = 65535;
+constexpr uint32_t hashLog = 12;
+
+uint32_t read32(const char *ptr) {
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - hashLog);
+}
+
+char *writeLength(char *op, size_t length) {
+    while (length >= 255) {
+        *op++ = static_cast<char>(255);
+        length -= 255;
+    }
+    *op++ = static_cast<char>(length);
+    return op;
+}
+
+char *writeSequence(char *op, const char *literals, size_t literalsLength, size_t offset, size_t matchLength) {
+    auto token = op++;
+    *token = static_cast<char>(std::min<size_t>(literalsLength, 15) << 4);
+    if (literalsLength >= 15) {
+        op = writeLength(op, literalsLength - 15);
+    }
+    if (literalsLength > 0) {
+        memcpy(op, literals, literalsLength);
+        op += literalsLength;
+    }
+
+    if (matchLength == 0) {
+        return op;
+    }
+    *op++ = static_cast<char>(offset & 0xff);
+    *op++ = static_cast<char>(offset >> 8);
+    matchLength -= minMatch;
+    *token |= static_cast<char>(std::min<size_t>(matchLength, 15));
+    if (matchLength >= 15) {
+        op = writeLength(op, matchLength - 15);
+    }
+    return op;
+}
+
+bool readLength(const uint8_t *&ip, const uint8_t *end, size_t &length) {
+    uint8_t value;
+    do {
+        if (ip >= end) {
+            return false;
+        }
+        value = *ip++;
+        length += value;
+    } while (value == 255);
+    return true;
+}
+} // namespace
+
+size_t getMaxCompressedSize(size_t size) {
+    return size + size / 255 + 16;
+}
+
+size_t compressBlock(const char *src, size_t srcSize, char *dst) {
+    std::unique_ptr<uint32_t[]> hashTable(new uint32_t[1u << hashLog]());
+    char *op = dst;
+    size_t anchor = 0;
+    size_t position = 0;
+
+    while (position + matchSearchLimit <= srcSize) {
+        auto sequence = read32(src + position);
+        auto &entry = hashTable[hashSequence(sequence)];
+        size_t candidate = entry;
+        entry = static_cast<uint32_t>(position + 1);
+
+        if (candidate == 0 || position - (candidate - 1) > maxOffset || read32(src + candidate - 1) != sequence) {
+            // skip faster through data that does not compress
+            position += 1 + ((position - anchor) >> 6);
+            continue;
+        }
+        candidate--;
+
+        size_t matchLength = minMatch;
+        auto matchLimit = srcSize - lastLiterals;
+        while (position + matchLength < matchLimit && src[candidate + matchLength] == src[position + matchLength]) {
+            matchLength++;
+        }
+
+        op = writeSequence(op, src + anchor, position - anchor, position - candidate, matchLength);
+        position += matchLength;
+        anchor = position;
+    }
+    op = writeSequence(op, src + anchor, srcSize - anchor, 0, 0);
+    return static_cast<size_t>(op - dst);
+}
+
+bool decompressBlock(const char *src, size_t srcSize, char *dst, size_t dstSize) {
+    auto ip = reinterpret_cast<const uint8_t *>(src);
+    auto ipEnd = ip + srcSize;
+    size_t op = 0;
+
+    while (ip < ipEnd) {
+        uint8_t token = *ip++;
+        size_t literalsLength = token >> 4;
+        if (literalsLength == 15 && !readLength(ip, ipEnd, literalsLength)) {
+            return false;
+        }
+        if (literalsLength > static_cast<size_t>(ipEnd - ip) || literalsLength > dstSize - op) {
+            return false;
+        }
+        if (literalsLength > 0) {
+            memcpy(dst + op, ip, literalsLength);
+            ip += literalsLength;
+            op += literalsLength;
+        }
+
+        if (ip == ipEnd) {
+            break;
+        }
+        if (ipEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        size_t matchLength = token & 0xf;
+        if (matchLength == 15 && !readLength(ip, ipEnd, matchLength)) {
+            return false;
+        }
+        matchLength += minMatch;
+        if (offset == 0 || offset > op || matchLength > dstSize - op) {
+            return false;
+        }
+        // matches may overlap their own output, copy byte by byte
+        for (size_t i = 0; i < matchLength; i++, op++) {
+            dst[op] = dst[op - offset];
+        }
+    }
+    return op == dstSize;
+}
+
+FrameWriter::FrameWriter(std::ostream &output, size_t frameSize) : output(output) {
+    compressedData.resize(getMaxCompressedSize(frameSize));
+
+    FileHeader header = {};
+    memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.frameSize = static_cast<uint32_t>(frameSize);
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    fileOffset = sizeof(header);
+}
+
+void FrameWriter::writeFrame(const char *data, size_t size) {
+    if (compressedData.size() < getMaxCompressedSize(size)) {
+        compressedData.resize(getMaxCompressedSize(size));
+    }
+    auto compressedSize = compressBlock(data, size, compressedData.data());
+    auto frameData = compressedData.data();
+    if (compressedSize >= size) {
+        compressedSize = size;
+        frameData = const_cast<char *>(data);
+    }
+
+    FrameHeader header = {static_cast<uint32_t>(size), static_cast<uint32_t>(compressedSize)};
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.write(frameData, compressedSize);
+
+    index.push_back({fileOffset, uncompressedOffset});
+    fileOffset += sizeof(header) + compressedSize;
+    uncompressedOffset += size;
+}
+
+void FrameWriter::writeIndex() {
+    FrameHeader endMarker = {0, 0};
+    output.write(reinterpret_cast<const char *>(&endMarker), sizeof(endMarker));
+    fileOffset += sizeof(endMarker);
+
+    IndexFooter footer = {};
+    footer.indexOffset = fileOffset;
+    footer.framesCount = static_cast<uint32_t>(index.size());
+    memcpy(footer.magic, indexMagic, sizeof(indexMagic));
+
+    output.write(reinterpret_cast<const char *>(index.data()), index.size() * sizeof(IndexEntry));
+    output.write(reinterpret_cast<const char *>(&footer), sizeof(footer));
+    fileOffset += index.size() * sizeof(IndexEntry) + sizeof(footer);
+    index.clear();
+}
+
+bool decompressFile(std::istream &input, std::ostream &output) {
+    FileHeader fileHeader = {};
+    if (!input.read(reinterpret_cast<char *>(&fileHeader), sizeof(fileHeader)) ||
+        memcmp(fileHeader.magic, fileMagic, sizeof(fileMagic)) != 0) {
+        return false;
+    }
+
+    std::vector<char> compressedData;
+    std::vector<char> data;
+    FrameHeader frameHeader = {};
+    while (input.read(reinterpret_cast<char *>(&frameHeader), sizeof(frameHeader))) {
+        if (frameHeader.uncompressedSize == 0 && frameHeader.compressedSize == 0) {
+            // end marker, the index follows
+            return true;
+        }
+        if (frameHeader.compressedSize == 0 || frameHeader.compressedSize > frameHeader.uncompressedSize ||
+            frameHeader.uncompressedSize > fileHeader.frameSize) {
+            return false;
+        }
+        compressedData.resize(frameHeader.compressedSize);
+        if (!input.read(compressedData.data(), compressedData.size())) {
+            // file was truncated inside the last frame
+            return true;
+        }
+        if (frameHeader.compressedSize == frameHeader.uncompressedSize) {
+            output.write(compressedData.data(), compressedData.size());
+            continue;
+        }
+        data.resize(frameHeader.uncompressedSize);
+        if (!decompressBlock(compressedData.data(), compressedData.size(), data.data(), data.size())) {
+            return false;
+        }
+        output.write(data.data(), data.size());
+    }
+    // file was not closed, everything up to the last complete frame was recovered
+    return true;
+}
+} // namespace AubCompression
+} // namespace AubMemDump
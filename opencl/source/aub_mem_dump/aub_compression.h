@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace AubMemDump {
+namespace AubCompression {
+
+// Compressed AUB container:
+//   FileHeader, then frames (FrameHeader + data, each frame holds up to frameSize bytes of raw AUB),
+//   then an index of IndexEntry per frame and an IndexFooter pointing at it.
+// Frame data uses an LZ4 style block encoding; frames that do not compress are stored raw.
+// A file without index (e.g. capture that was not closed) can still be decompressed sequentially.
+constexpr char fileMagic[8] = {'N', 'E', 'O', 'A', 'U', 'B', 'Z', '1'};
+constexpr char indexMagic[4] = {'A', 'I', 'D', 'X'};
+constexpr char fileExtensionSuffix[] = "z";
+
+#pragma pack(push, 4)
+struct FileHeader {
+    char magic[sizeof(fileMagic)];
+    uint32_t frameSize;
+};
+
+struct FrameHeader {
+    uint32_t uncompressedSize;
+    uint32_t compressedSize;
+};
+
+struct IndexEntry {
+    uint64_t fileOffset;
+    uint64_t uncompressedOffset;
+};
+
+struct IndexFooter {
+    uint64_t indexOffset;
+    uint32_t framesCount;
+    char magic[sizeof(indexMagic)];
+};
+#pragma pack(pop)
+
+size_t getMaxCompressedSize(size_t size);
+size_t compressBlock(const char *src, size_t srcSize, char *dst);
+bool decompressBlock(const char *src, size_t srcSize, char *dst, size_t dstSize);
+
+class FrameWriter {
+  public:
+    FrameWriter(std::ostream &output, size_t frameSize);
+
+    void writeFrame(const char *data, size_t size);
+    void writeIndex();
+
+  protected:
+    std::ostream &output;
+    std::vector<char> compressedData;
+    std::vector<IndexEntry> index;
+    uint64_t fileOffset = 0;
+    uint64_t uncompressedOffset = 0;
+};
+
+bool decompressFile(std::istream &input, std::ostream &output);
+} // namespace AubCompression
+} // namespace AubMemDump
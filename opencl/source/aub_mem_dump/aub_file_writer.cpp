@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace AubMemDump {
+
+constexpr size_t AubFileWriter::defaultBufferSize;
+
+AubFileWriter::AubFileWriter(std::ostream &output, size_t bufferSize, bool compress) : output(output), bufferSize(bufferSize) {
+    activeBuffer.reserve(bufferSize);
+    pendingBuffer.reserve(bufferSize);
+    if (compress) {
+        frameWriter = std::make_unique<AubCompression::FrameWriter>(output, bufferSize);
+    }
+    writerThread = NEO::Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AubFileWriter::~AubFileWriter() {
+    std::unique_lock<std::mutex> lock(mutex);
+    submitActiveBuffer(lock);
+    stopWriting = true;
+    lock.unlock();
+    condition.notify_all();
+
+    writerThread->join();
+
+    if (frameWriter) {
+        frameWriter->writeIndex();
+        output.flush();
+    }
+}
+
+void AubFileWriter::write(const char *data, size_t size) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (size > 0) {
+        auto chunkSize = std::min(size, bufferSize - activeBuffer.size());
+        activeBuffer.insert(activeBuffer.end(), data, data + chunkSize);
+        data += chunkSize;
+        size -= chunkSize;
+
+        if (activeBuffer.size() == bufferSize) {
+            submitActiveBuffer(lock);
+        }
+    }
+}
+
+void AubFileWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (pendingBuffer.empty()) {
+        submitActiveBuffer(lock);
+    } else {
+        // writer thread is busy, it picks up the active buffer when done
+        flushRequested = true;
+    }
+}
+
+void AubFileWriter::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    submitActiveBuffer(lock);
+    condition.wait(lock, [this] { return pendingBuffer.empty(); });
+}
+
+void AubFileWriter::submitActiveBuffer(std::unique_lock<std::mutex> &lock) {
+    if (activeBuffer.empty()) {
+        return;
+    }
+    condition.wait(lock, [this] { return pendingBuffer.empty(); });
+    activeBuffer.swap(pendingBuffer);
+    flushRequested = false;
+    condition.notify_all();
+}
+
+void *AubFileWriter::run(void *arg) {
+    auto self = reinterpret_cast<AubFileWriter *>(arg);
+    std::unique_lock<std::mutex> lock(self->mutex);
+    while (true) {
+        self->condition.wait(lock, [self] { return !self->pendingBuffer.empty() || self->stopWriting; });
+        if (self->pendingBuffer.empty()) {
+            break;
+        }
+        // callers keep filling the active buffer while the pending one is written
+        lock.unlock();
+        if (self->frameWriter) {
+            self->frameWriter->writeFrame(self->pendingBuffer.data(), self->pendingBuffer.size());
+        } else {
+            self->output.write(self->pendingBuffer.data(), self->pendingBuffer.size());
+        }
+        self->output.flush();
+        lock.lock();
+
+        self->pendingBuffer.clear();
+        if (self->flushRequested) {
+            self->submitActiveBuffer(lock);
+        }
+        self->condition.notify_all();
+    }
+    return nullptr;
+}
+} // namespace AubMemDump
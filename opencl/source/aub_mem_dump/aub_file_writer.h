@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "opencl/source/aub_mem_dump/aub_compression.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+}
+
+namespace AubMemDump {
+
+// Writes AUB data to the output stream from a background thread.
+// Callers fill one buffer while the thread writes the other one, so they only
+// block on disk I/O when both buffers are full. Flush never waits for the thread.
+// Data is written in submission order. With compression enabled the thread also
+// compresses each buffer into a frame of the compressed AUB container.
+class AubFileWriter : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultBufferSize = 4 * 1024 * 1024;
+
+    AubFileWriter(std::ostream &output, size_t bufferSize, bool compress);
+    ~AubFileWriter();
+
+    void write(const char *data, size_t size);
+    void flush();
+    void drain();
+
+  protected:
+    static void *run(void *arg);
+    void submitActiveBuffer(std::unique_lock<std::mutex> &lock);
+
+    std::ostream &output;
+    const size_t bufferSize;
+    std::vector<char> activeBuffer;
+    std::vector<char> pendingBuffer;
+    bool flushRequested = false;
+    bool stopWriting = false;
+    std::unique_ptr<AubCompression::FrameWriter> frameWriter;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::unique_ptr<NEO::Thread> writerThread;
+};
+} // namespace AubMemDump
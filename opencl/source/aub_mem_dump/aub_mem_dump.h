@@ -17,6 +17,7 @@
 #endif
 
 #include "opencl/source/aub_mem_dump/aub_data.h"
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
 
 namespace NEO {
 class AubHelper;
@@ -143,6 +144,7 @@ struct AubFileStream : public AubStream {
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
 
     std::ofstream fileHandle;
+    std::unique_ptr<AubFileWriter> fileWriter;
     std::string fileName;
     std::mutex mutex;
 };
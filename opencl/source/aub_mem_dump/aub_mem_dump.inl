@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -124,8 +125,10 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+    // page walks report physically contiguous extents, map every page of the extent
+    auto blockSize = alignUp(static_cast<size_t>(physAddress - pAddr) + size, MemoryConstants::pageSize);
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, blockSize, pAddr, additionalBits, aubHelper);
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/local_ids_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+
+#include "opencl/source/command_queue/local_id_gen.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+constexpr size_t LocalIdsCache::defaultCacheSize;
+
+LocalIdsCache::LocalIdsCache() : LocalIdsCache(DebugManager.flags.LocalIdsCacheSize.get() != -1
+                                                   ? static_cast<size_t>(DebugManager.flags.LocalIdsCacheSize.get())
+                                                   : defaultCacheSize) {}
+
+LocalIdsCache::LocalIdsCache(size_t cacheSize) : cacheSize(cacheSize) {}
+
+size_t LocalIdsCache::getLocalIdsSizeForGroup(uint16_t simd, const std::array<uint16_t, 3> &groupSize, uint32_t grfSize) {
+    auto itemsInGroup = static_cast<size_t>(groupSize[0]) * groupSize[1] * groupSize[2];
+    return getThreadsPerWG(simd, itemsInGroup) * getPerThreadSizeLocalIDs(simd, grfSize);
+}
+
+void LocalIdsCache::setLocalIdsForGroup(void *destination, uint16_t simd, const std::array<uint16_t, 3> &groupSize,
+                                        const std::array<uint8_t, 3> &walkOrder, bool isImageOnlyKernel, uint32_t grfSize) {
+    if (cacheSize == 0u) {
+        generateLocalIDs(destination, simd, groupSize, walkOrder, isImageOnlyKernel, grfSize);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &entry = getEntry({groupSize, walkOrder, simd, grfSize, isImageOnlyKernel});
+    memcpy(destination, entry.localIds.get(), entry.localIdsSize);
+}
+
+LocalIdsCache::LocalIdsCacheEntry &LocalIdsCache::getEntry(const LocalIdsCacheKey &key) {
+    usageCounter++;
+    for (auto &entry : entries) {
+        if (entry.key == key) {
+            entry.lastUsed = usageCounter;
+            hits++;
+            return entry;
+        }
+    }
+    misses++;
+
+    LocalIdsCacheEntry *entry = nullptr;
+    if (entries.size() < cacheSize) {
+        entries.emplace_back();
+        entry = &entries.back();
+    } else {
+        entry = &*std::min_element(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.lastUsed < rhs.lastUsed;
+        });
+    }
+
+    // generators use aligned vector stores
+    entry->key = key;
+    entry->localIdsSize = getLocalIdsSizeForGroup(key.simd, key.groupSize, key.grfSize);
+    entry->localIds = allocateAlignedMemory(entry->localIdsSize, 32);
+    memset(entry->localIds.get(), 0, entry->localIdsSize);
+    generateLocalIDs(entry->localIds.get(), key.simd, key.groupSize, key.walkOrder, key.isImageOnlyKernel, key.grfSize);
+    entry->lastUsed = usageCounter;
+    return *entry;
+}
+} // namespace NEO
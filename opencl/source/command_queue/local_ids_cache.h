@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Keeps local IDs generated for the most recently used group shapes,
+// so dispatching a known shape copies the payload instead of generating it.
+class LocalIdsCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultCacheSize = 8u;
+
+    LocalIdsCache();
+    LocalIdsCache(size_t cacheSize);
+
+    void setLocalIdsForGroup(void *destination, uint16_t simd, const std::array<uint16_t, 3> &groupSize,
+                             const std::array<uint8_t, 3> &walkOrder, bool isImageOnlyKernel, uint32_t grfSize);
+    static size_t getLocalIdsSizeForGroup(uint16_t simd, const std::array<uint16_t, 3> &groupSize, uint32_t grfSize);
+
+    size_t getCacheSize() const { return cacheSize; }
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+
+  protected:
+    struct LocalIdsCacheKey {
+        std::array<uint16_t, 3> groupSize;
+        std::array<uint8_t, 3> walkOrder;
+        uint16_t simd;
+        uint32_t grfSize;
+        bool isImageOnlyKernel;
+
+        bool operator==(const LocalIdsCacheKey &other) const {
+            return groupSize == other.groupSize && walkOrder == other.walkOrder && simd == other.simd &&
+                   grfSize == other.grfSize && isImageOnlyKernel == other.isImageOnlyKernel;
+        }
+    };
+
+    struct LocalIdsCacheEntry {
+        LocalIdsCacheKey key;
+        std::unique_ptr<void, std::function<void(void *)>> localIds;
+        size_t localIdsSize = 0u;
+        uint64_t lastUsed = 0u;
+    };
+
+    LocalIdsCacheEntry &getEntry(const LocalIdsCacheKey &key);
+
+    const size_t cacheSize;
+    std::vector<LocalIdsCacheEntry> entries;
+    uint64_t usageCounter = 0u;
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    std::mutex mutex;
+};
+} // namespace NEO
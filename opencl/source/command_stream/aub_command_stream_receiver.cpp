@@ -7,6 +7,7 @@
 
 #include "opencl/source/command_stream/aub_command_stream_receiver.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -80,20 +81,38 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 extern const size_t g_dwordCountMax;
 
 void AubFileStream::open(const char *filePath) {
-    fileHandle.open(filePath, std::ofstream::binary);
+    bool compress = NEO::DebugManager.flags.AUBDumpCompression.get();
+    if (compress) {
+        fileHandle.open(std::string(filePath) + AubCompression::fileExtensionSuffix, std::ofstream::binary);
+    } else {
+        fileHandle.open(filePath, std::ofstream::binary);
+    }
     fileName.assign(filePath);
+    if ((NEO::DebugManager.flags.AUBDumpWriteInBackground.get() || compress) && fileHandle.is_open()) {
+        fileWriter = std::make_unique<AubFileWriter>(fileHandle, AubFileWriter::defaultBufferSize, compress);
+    }
 }
 
 void AubFileStream::close() {
+    fileWriter.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (fileWriter) {
+        fileWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (fileWriter) {
+        // hand buffered data over to the writer thread, it flushes the file after writing
+        fileWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -107,6 +107,9 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::reopenFile(const std::string &fileNa
         if (fileName != getFileName()) {
             closeFile();
             this->freeEngineInfo(*gttRemap);
+            if (this->dirtyPageTracker) {
+                this->dirtyPageTracker->clearPages();
+            }
         }
     }
     if (!isFileOpen()) {
@@ -600,6 +603,9 @@ template <typename GfxFamily>
 void AUBCommandStreamReceiverHw<GfxFamily>::makeNonResidentExternal(uint64_t gpuAddress) {
     for (auto it = externalAllocations.begin(); it != externalAllocations.end(); it++) {
         if (it->first == gpuAddress) {
+            if (this->dirtyPageTracker) {
+                this->dirtyPageTracker->removePages(GmmHelper::decanonize(it->first), it->second);
+            }
             externalAllocations.erase(it);
             break;
         }
@@ -643,7 +649,7 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        this->writeChangedMemory(gfxAllocation, gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
 
     streamLocked.unlock();
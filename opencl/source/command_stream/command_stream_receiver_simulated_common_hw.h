@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 
+#include "opencl/source/command_stream/dirty_page_tracker.h"
 #include "opencl/source/memory_manager/memory_banks.h"
 
 #include "aub_mapper.h"
@@ -30,8 +31,11 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     using MiContextDescriptorReg = typename AUB::MiContextDescriptorReg;
 
     bool getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const;
+    size_t getSizeForWriteMemory(GraphicsAllocation &graphicsAllocation) const;
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
+    bool isDirtyPageTrackingEnabled(GraphicsAllocation &graphicsAllocation) const;
+    void writeChangedMemory(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits);
 
   public:
     CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
@@ -64,11 +68,13 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     virtual void dumpAllocation(GraphicsAllocation &gfxAllocation) = 0;
 
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
+    void invalidateAllocationPages(GraphicsAllocation &gfxAllocation) override;
 
     size_t getPreferredTagPoolSize() const override { return 1; }
 
     aub_stream::AubManager *aubManager = nullptr;
     std::unique_ptr<HardwareContextController> hardwareContextController;
+    std::unique_ptr<DirtyPageTracker> dirtyPageTracker;
 
     struct EngineInfo {
         void *pLRCA;
@@ -9,6 +9,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -46,14 +47,19 @@ void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::setupContext(OsContext &
 }
 
 template <typename GfxFamily>
-bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const {
-    cpuAddress = graphicsAllocation.getUnderlyingBuffer();
-    gpuAddress = GmmHelper::decanonize(graphicsAllocation.getGpuAddress());
-    size = graphicsAllocation.getUnderlyingBufferSize();
+size_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getSizeForWriteMemory(GraphicsAllocation &graphicsAllocation) const {
     auto gmm = graphicsAllocation.getDefaultGmm();
     if (gmm && gmm->isRenderCompressed) {
-        size = gmm->gmmResourceInfo->getSizeAllocation();
+        return gmm->gmmResourceInfo->getSizeAllocation();
     }
+    return graphicsAllocation.getUnderlyingBufferSize();
+}
+
+template <typename GfxFamily>
+bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const {
+    cpuAddress = graphicsAllocation.getUnderlyingBuffer();
+    gpuAddress = GmmHelper::decanonize(graphicsAllocation.getGpuAddress());
+    size = getSizeForWriteMemory(graphicsAllocation);
 
     if (size == 0)
         return false;
@@ -64,6 +70,35 @@ bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMem
     return true;
 }
 
+template <typename GfxFamily>
+bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::isDirtyPageTrackingEnabled(GraphicsAllocation &graphicsAllocation) const {
+    if (!dirtyPageTracker) {
+        return false;
+    }
+    // content hashes cannot observe GPU writes made inside the simulator, so by default
+    // only allocations the GPU never writes to are eligible for skipping
+    return DebugManager.flags.AUBDumpChangedPagesOnly.get() == 2 ||
+           AubHelper::isGpuReadOnlyAllocationType(graphicsAllocation.getAllocationType());
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::writeChangedMemory(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) {
+    if (!isDirtyPageTrackingEnabled(graphicsAllocation)) {
+        if (dirtyPageTracker) {
+            // hashes of pages overwritten here would go stale
+            dirtyPageTracker->removePages(gpuAddress, size);
+        }
+        writeMemory(gpuAddress, cpuAddress, size, memoryBank, entryBits);
+        return;
+    }
+
+    DirtyPageTracker::ChangedRanges changedRanges;
+    dirtyPageTracker->findChangedRanges(gpuAddress, cpuAddress, size, changedRanges);
+    for (auto &range : changedRanges) {
+        writeMemory(gpuAddress + range.first, ptrOffset(cpuAddress, range.first), range.second, memoryBank, entryBits);
+    }
+}
+
 template <typename GfxFamily>
 bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::expectMemoryEqual(void *gfxAddress, const void *srcAddress, size_t length) {
     return this->expectMemory(gfxAddress, srcAddress, length,
@@ -99,12 +134,32 @@ void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::makeNonResident(Graphics
     }
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::invalidateAllocationPages(GraphicsAllocation &gfxAllocation) {
+    if (!dirtyPageTracker) {
+        return;
+    }
+    // the VA may be reused by a new allocation with content matching the stale hashes
+    dirtyPageTracker->removePages(GmmHelper::decanonize(gfxAllocation.getGpuAddress()), getSizeForWriteMemory(gfxAllocation));
+}
+
 template <typename GfxFamily>
 uint32_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getDeviceIndex() const {
     return osContext->getDeviceBitfield().any() ? static_cast<uint32_t>(Math::log2(static_cast<uint32_t>(osContext->getDeviceBitfield().to_ulong()))) : 0u;
 }
 template <typename GfxFamily>
-CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) : CommandStreamReceiverHw<GfxFamily>(executionEnvironment, rootDeviceIndex) {}
+CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) : CommandStreamReceiverHw<GfxFamily>(executionEnvironment, rootDeviceIndex) {
+    if (DebugManager.flags.AUBDumpChangedPagesOnly.get() > 0) {
+        dirtyPageTracker = std::make_unique<DirtyPageTracker>();
+    }
+}
 template <typename GfxFamily>
-CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() = default;
+CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() {
+    if (dirtyPageTracker) {
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                         "Simulated CSR memory uploads: %llu bytes written, %llu bytes of unchanged pages skipped\n",
+                         static_cast<unsigned long long>(dirtyPageTracker->getBytesWritten()),
+                         static_cast<unsigned long long>(dirtyPageTracker->getBytesSkipped()));
+    }
+}
 } // namespace NEO
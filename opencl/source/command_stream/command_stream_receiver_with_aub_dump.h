@@ -25,6 +25,7 @@ class CommandStreamReceiverWithAUBDump : public BaseCSR {
 
     bool flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
+    void invalidateAllocationPages(GraphicsAllocation &gfxAllocation) override;
 
     AubSubCaptureStatus checkAndActivateAubSubCapture(const MultiDispatchInfo &dispatchInfo) override;
     void setupContext(OsContext &osContext) override;
@@ -48,6 +48,14 @@ void CommandStreamReceiverWithAUBDump<BaseCSR>::makeNonResident(GraphicsAllocati
     }
 }
 
+template <typename BaseCSR>
+void CommandStreamReceiverWithAUBDump<BaseCSR>::invalidateAllocationPages(GraphicsAllocation &gfxAllocation) {
+    BaseCSR::invalidateAllocationPages(gfxAllocation);
+    if (aubCSR) {
+        aubCSR->invalidateAllocationPages(gfxAllocation);
+    }
+}
+
 template <typename BaseCSR>
 AubSubCaptureStatus CommandStreamReceiverWithAUBDump<BaseCSR>::checkAndActivateAubSubCapture(const MultiDispatchInfo &dispatchInfo) {
     auto status = BaseCSR::checkAndActivateAubSubCapture(dispatchInfo);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_stream/dirty_page_tracker.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace NEO {
+
+template <typename ChunkHandlerT>
+void DirtyPageTracker::forEachPageChunk(uint64_t gpuAddress, size_t size, ChunkHandlerT handler) {
+    auto endAddress = gpuAddress + size;
+    auto chunkAddress = gpuAddress;
+    while (chunkAddress < endAddress) {
+        auto pageAddress = alignDown(chunkAddress, MemoryConstants::pageSize);
+        auto chunkEnd = std::min(pageAddress + MemoryConstants::pageSize, endAddress);
+        handler(pageAddress, static_cast<size_t>(chunkAddress - gpuAddress), static_cast<size_t>(chunkEnd - chunkAddress));
+        chunkAddress = chunkEnd;
+    }
+}
+
+DirtyPageTracker::PageState DirtyPageTracker::getPageState(uint64_t chunkGpuAddress, const void *chunkCpuAddress, size_t chunkSize) {
+    return {FastHash::hash(static_cast<const char *>(chunkCpuAddress), chunkSize),
+            static_cast<uint32_t>(chunkGpuAddress & (MemoryConstants::pageSize - 1)),
+            static_cast<uint32_t>(chunkSize)};
+}
+
+void DirtyPageTracker::findChangedRanges(uint64_t gpuAddress, const void *cpuAddress, size_t size, ChangedRanges &changedRanges) {
+    std::lock_guard<std::mutex> lock(mutex);
+    changedRanges.clear();
+    forEachPageChunk(gpuAddress, size, [&](uint64_t pageAddress, size_t offset, size_t chunkSize) {
+        auto newState = getPageState(gpuAddress + offset, ptrOffset(cpuAddress, offset), chunkSize);
+        auto &state = pages[pageAddress];
+        if (state.size == newState.size && state.offsetInPage == newState.offsetInPage && state.hash == newState.hash) {
+            bytesSkipped += chunkSize;
+            return;
+        }
+        state = newState;
+        bytesWritten += chunkSize;
+
+        if (!changedRanges.empty() && changedRanges.back().first + changedRanges.back().second == offset) {
+            changedRanges.back().second += chunkSize;
+        } else {
+            changedRanges.emplace_back(offset, chunkSize);
+        }
+    });
+}
+
+void DirtyPageTracker::updatePages(uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    forEachPageChunk(gpuAddress, size, [&](uint64_t pageAddress, size_t offset, size_t chunkSize) {
+        pages[pageAddress] = getPageState(gpuAddress + offset, ptrOffset(cpuAddress, offset), chunkSize);
+    });
+}
+
+void DirtyPageTracker::clearPages() {
+    std::lock_guard<std::mutex> lock(mutex);
+    pages.clear();
+}
+
+size_t DirtyPageTracker::getTrackedPagesCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pages.size();
+}
+
+void DirtyPageTracker::removePages(uint64_t gpuAddress, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto startPage = alignDown(gpuAddress, MemoryConstants::pageSize);
+    auto endAddress = gpuAddress + size;
+    if ((endAddress - startPage) / MemoryConstants::pageSize > pages.size()) {
+        for (auto it = pages.begin(); it != pages.end();) {
+            it = (it->first >= startPage && it->first < endAddress) ? pages.erase(it) : std::next(it);
+        }
+        return;
+    }
+    forEachPageChunk(gpuAddress, size, [&](uint64_t pageAddress, size_t, size_t) {
+        pages.erase(pageAddress);
+    });
+}
+} // namespace NEO
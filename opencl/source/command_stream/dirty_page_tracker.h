@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// Remembers the content hash of every page written to the simulator,
+// so memory uploads can skip pages that did not change since the last write.
+// Pages are also dropped from the free path outside of CSR ownership, so access is guarded by own mutex.
+class DirtyPageTracker : NonCopyableOrMovableClass {
+  public:
+    using ChangedRanges = std::vector<std::pair<size_t, size_t>>; // offset and size within the written range
+
+    void findChangedRanges(uint64_t gpuAddress, const void *cpuAddress, size_t size, ChangedRanges &changedRanges);
+    void updatePages(uint64_t gpuAddress, const void *cpuAddress, size_t size);
+    void removePages(uint64_t gpuAddress, size_t size);
+    void clearPages();
+
+    uint64_t getBytesWritten() const { return bytesWritten; }
+    uint64_t getBytesSkipped() const { return bytesSkipped; }
+    size_t getTrackedPagesCount() const;
+
+  protected:
+    struct PageState {
+        uint64_t hash;
+        uint32_t offsetInPage;
+        uint32_t size;
+    };
+
+    template <typename ChunkHandlerT>
+    static void forEachPageChunk(uint64_t gpuAddress, size_t size, ChunkHandlerT handler);
+    static PageState getPageState(uint64_t chunkGpuAddress, const void *chunkCpuAddress, size_t chunkSize);
+
+    mutable std::mutex mutex;
+    std::unordered_map<uint64_t, PageState> pages;
+    uint64_t bytesWritten = 0u;
+    uint64_t bytesSkipped = 0u;
+};
+} // namespace NEO
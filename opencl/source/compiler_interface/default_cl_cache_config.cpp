@@ -7,6 +7,7 @@
 
 #include "default_cl_cache_config.h"
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
 #include "opencl/source/os_interface/ocl_reg_path.h"
@@ -28,6 +29,21 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
 
     ret.cacheFileExtension = ".cl_cache";
 
+    keyName = oclRegPath;
+    keyName += "cl_cache_max_size";
+    settingsReader.reset(SettingsReader::createOsReader(false, keyName));
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<int64_t>(0)));
+
+    keyName = oclRegPath;
+    keyName += "cl_cache_in_memory_size";
+    settingsReader.reset(SettingsReader::createOsReader(false, keyName));
+    ret.inMemoryCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<int64_t>(32 * MemoryConstants::megaByte)));
+
+    keyName = oclRegPath;
+    keyName += "cl_cache_map_binaries";
+    settingsReader.reset(SettingsReader::createOsReader(false, keyName));
+    ret.mapCachedBinaries = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), true);
+
     return ret;
 }
 } // namespace NEO
@@ -113,7 +113,8 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
         numChannels,
         localWorkSize,
         kernel.getKernelInfo().workgroupDimensionsOrder,
-        kernel.usesOnlyImages());
+        kernel.usesOnlyImages(),
+        &kernel.getLocalIdsCache());
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
@@ -10,6 +10,8 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/debug_helpers.h"
 
+#include "opencl/source/command_queue/local_ids_cache.h"
+
 #include <array>
 
 namespace NEO {
@@ -21,7 +23,8 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const size_t localWorkSizes[3],
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    LocalIdsCache *localIdsCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         auto localWorkSize = localWorkSizes[0] * localWorkSizes[1] * localWorkSizes[2];
@@ -30,12 +33,15 @@ size_t PerThreadDataHelper::sendPerThreadData(
 
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
-        generateLocalIDs(pDest, static_cast<uint16_t>(simd),
-                         std::array<uint16_t, 3>{{static_cast<uint16_t>(localWorkSizes[0]),
-                                                  static_cast<uint16_t>(localWorkSizes[1]),
-                                                  static_cast<uint16_t>(localWorkSizes[2])}},
-                         std::array<uint8_t, 3>{{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}},
-                         hasKernelOnlyImages, grfSize);
+        std::array<uint16_t, 3> groupSize{{static_cast<uint16_t>(localWorkSizes[0]),
+                                           static_cast<uint16_t>(localWorkSizes[1]),
+                                           static_cast<uint16_t>(localWorkSizes[2])}};
+        std::array<uint8_t, 3> walkOrder{{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}};
+        if (localIdsCache) {
+            localIdsCache->setLocalIdsForGroup(pDest, static_cast<uint16_t>(simd), groupSize, walkOrder, hasKernelOnlyImages, grfSize);
+        } else {
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), groupSize, walkOrder, hasKernelOnlyImages, grfSize);
+        }
     }
     return offsetPerThreadData;
 }
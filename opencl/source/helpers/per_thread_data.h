@@ -16,6 +16,7 @@
 
 namespace NEO {
 class LinearStream;
+class LocalIdsCache;
 
 struct PerThreadDataHelper {
     static inline uint32_t getLocalIdSizePerThread(
@@ -40,7 +41,8 @@ struct PerThreadDataHelper {
         uint32_t numChannels,
         const size_t localWorkSizes[3],
         const std::array<uint8_t, 3> &workgroupWalkOrder,
-        bool hasKernelOnlyImages);
+        bool hasKernelOnlyImages,
+        LocalIdsCache *localIdsCache = nullptr);
 
     static inline uint32_t getNumLocalIdChannels(const iOpenCL::SPatchThreadPayload &threadPayload) {
         return threadPayload.LocalIDXPresent +
@@ -17,6 +17,7 @@
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/cl_types.h"
+#include "opencl/source/command_queue/local_ids_cache.h"
 #include "opencl/source/device_queue/device_queue.h"
 #include "opencl/source/helpers/base_object.h"
 #include "opencl/source/helpers/properties_helper.h"
@@ -381,6 +382,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     bool usesOnlyImages() const {
         return usingImagesOnly;
     }
+    LocalIdsCache &getLocalIdsCache() { return localIdsCache; }
 
     void fillWithBuffersForAuxTranslation(MemObjsForAuxTranslation &memObjsForAuxTranslation);
 
@@ -544,6 +546,7 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     std::vector<PatchInfoData> patchInfoDataList;
     std::unique_ptr<ImageTransformer> imageTransformer;
+    LocalIdsCache localIdsCache;
 
     bool specialPipelineSelectMode = false;
     bool svmAllocationsRequireCacheFlush = false;
@@ -9,59 +9,81 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 
-#include <inttypes.h>
-#include <iostream>
+#include <iterator>
 
 namespace NEO {
 
 AddressMapper::AddressMapper() : nextPage(1) {
 }
-AddressMapper::~AddressMapper() {
-    for (auto &m : mapping)
-        delete m;
-}
+AddressMapper::~AddressMapper() = default;
+
 uint32_t AddressMapper::map(void *vm, size_t size) {
     void *aligned = alignDown(vm, MemoryConstants::pageSize);
     size_t alignedSize = alignSizeWholePage(vm, size);
 
-    auto it = mapping.begin();
-    for (; it != mapping.end(); it++) {
-        if ((*it)->vm == aligned) {
-            if ((*it)->size == alignedSize) {
-                return (*it)->ggtt;
-            }
-            break;
-        }
-    }
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = mapping.find(aligned);
     if (it != mapping.end()) {
-        delete *it;
+        if (it->second.size == alignedSize) {
+            return it->second.ggtt;
+        }
+        freePages(static_cast<uint32_t>(it->second.ggtt / MemoryConstants::pageSize), static_cast<uint32_t>(it->second.size / MemoryConstants::pageSize));
         mapping.erase(it);
     }
     uint32_t numPages = static_cast<uint32_t>(alignedSize / MemoryConstants::pageSize);
-    auto tmp = nextPage.fetch_add(numPages);
+    auto ggtt = static_cast<uint32_t>(allocatePages(numPages) * MemoryConstants::pageSize);
 
-    MapInfo *m = new MapInfo;
-    m->vm = aligned;
-    m->size = alignedSize;
-    m->ggtt = static_cast<uint32_t>(tmp * MemoryConstants::pageSize);
-
-    mapping.push_back(m);
-
-    return m->ggtt;
+    mapping[aligned] = {alignedSize, ggtt};
+    return ggtt;
 }
 
 void AddressMapper::unmap(void *vm) {
     void *aligned = alignDown(vm, MemoryConstants::pageSize);
 
-    auto it = mapping.begin();
-    for (; it != mapping.end(); it++) {
-        if ((*it)->vm == aligned) {
-            break;
-        }
-    }
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = mapping.find(aligned);
     if (it != mapping.end()) {
-        delete *it;
+        freePages(static_cast<uint32_t>(it->second.ggtt / MemoryConstants::pageSize), static_cast<uint32_t>(it->second.size / MemoryConstants::pageSize));
         mapping.erase(it);
     }
 }
+
+uint32_t AddressMapper::allocatePages(uint32_t numPages) {
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); it++) {
+        if (it->second < numPages) {
+            continue;
+        }
+        auto firstPage = it->first;
+        auto remainingPages = it->second - numPages;
+        freeRanges.erase(it);
+        if (remainingPages > 0) {
+            freeRanges.emplace(firstPage + numPages, remainingPages);
+        }
+        return firstPage;
+    }
+    auto firstPage = nextPage;
+    nextPage += numPages;
+    return firstPage;
+}
+
+void AddressMapper::freePages(uint32_t firstPage, uint32_t numPages) {
+    if (numPages == 0) {
+        return;
+    }
+    auto next = freeRanges.lower_bound(firstPage);
+    if (next != freeRanges.end() && firstPage + numPages == next->first) {
+        numPages += next->second;
+        next = freeRanges.erase(next);
+    }
+    if (next != freeRanges.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == firstPage) {
+            previous->second += numPages;
+            firstPage = previous->first;
+            numPages = previous->second;
+            freeRanges.erase(previous);
+        }
+    }
+    freeRanges.emplace(firstPage, numPages);
+}
 } // namespace NEO
@@ -6,9 +6,11 @@
  */
 
 #pragma once
-#include <atomic>
 #include <cstddef>
-#include <vector>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -19,16 +21,21 @@ class AddressMapper {
 
     // maps to continuous region
     uint32_t map(void *vm, size_t size);
-    // unmaps
+    // unmaps, GGTT pages of the mapping are reused by following maps
     void unmap(void *vm);
 
   protected:
     struct MapInfo {
-        void *vm;
         size_t size;
         uint32_t ggtt;
     };
-    std::vector<MapInfo *> mapping;
-    std::atomic<uint32_t> nextPage;
+    uint32_t allocatePages(uint32_t numPages);
+    void freePages(uint32_t firstPage, uint32_t numPages);
+
+    std::unordered_map<void *, MapInfo> mapping;
+    // first page -> number of pages of freed GGTT ranges, adjacent ranges are merged
+    std::map<uint32_t, uint32_t> freeRanges;
+    uint32_t nextPage;
+    std::mutex mtx;
 };
 } // namespace NEO
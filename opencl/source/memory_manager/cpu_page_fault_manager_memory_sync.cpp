@@ -6,21 +6,31 @@
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 
 namespace NEO {
-void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
+void PageFaultManager::transferToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptr, size, 0, nullptr, nullptr, false);
+    auto chunkPtr = ptrOffset(ptr, offset);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, chunkPtr, size, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
+
+    // chunk is copied back only after CPU writes it and transferToGpu inserts its own map operation,
+    // drop this one so that next map of this chunk copies data again
+    auto unifiedMemoryManager = memoryData[ptr].unifiedMemoryManager;
+    if (unifiedMemoryManager->getSvmMapOperation(chunkPtr)) {
+        unifiedMemoryManager->removeSvmMapOperation(chunkPtr);
+    }
 }
-void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
+void PageFaultManager::transferToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
-    auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
+    auto chunkPtr = ptrOffset(ptr, offset);
+    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(chunkPtr, size, ptr, offset, false);
+    auto retVal = commandQueue->enqueueSVMUnmap(chunkPtr, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
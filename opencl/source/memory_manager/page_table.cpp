@@ -24,8 +24,7 @@ uintptr_t PTE::map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memor
 
     for (size_t index = indexStart; index <= indexEnd; index++) {
         if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+            reserveEntries(index, indexEnd, newEntryBits, memoryBank);
         } else if (updateEntryBits) {
             entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
         }
@@ -40,28 +39,60 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     const auto mask = static_cast<uint32_t>(maxNBitValue(bits));
     size_t indexStart = (vm >> shift) & mask;
     size_t indexEnd = ((vm + size - 1) >> shift) & mask;
-    uint64_t res = -1;
     uintptr_t rem = vm & (pageSize - 1);
     bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
     uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
     newEntryBits |= 0x1;
 
+    // physically contiguous pages with the same entry bits are reported to the walker as one extent
+    uint64_t extentAddress = 0;
+    size_t extentSize = 0;
+    size_t extentOffset = offset;
+    uint64_t extentEntryBits = 0;
+
     for (size_t index = indexStart; index <= indexEnd; index++) {
         if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+            reserveEntries(index, indexEnd, newEntryBits, memoryBank);
         } else if (updateEntryBits) {
             entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
         }
-        res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
-
+        auto entry = reinterpret_cast<uintptr_t>(entries[index]);
+        uint64_t physAddress = (entry & MemoryConstants::page4kEntryMask) + rem;
+        uint64_t pageEntryBits = entry & MemoryConstants::pageMask;
         size_t lSize = std::min(pageSize - rem, size);
-        pageWalker((res & ~0x1) + rem, lSize, offset, reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask);
+
+        if (extentSize != 0 && extentAddress + extentSize == physAddress && extentEntryBits == pageEntryBits) {
+            extentSize += lSize;
+        } else {
+            if (extentSize != 0) {
+                pageWalker(extentAddress, extentSize, extentOffset, extentEntryBits);
+            }
+            extentAddress = physAddress;
+            extentSize = lSize;
+            extentOffset = offset;
+            extentEntryBits = pageEntryBits;
+        }
 
         size -= lSize;
         offset += lSize;
         rem = 0;
     }
+    if (extentSize != 0) {
+        pageWalker(extentAddress, extentSize, extentOffset, extentEntryBits);
+    }
+}
+
+void PTE::reserveEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank) {
+    size_t pagesCount = 1;
+    while (indexStart + pagesCount <= indexEnd && entries[indexStart + pagesCount] == 0x0) {
+        pagesCount++;
+    }
+
+    uint64_t physAddress = allocator->reserve4kPages(memoryBank, pagesCount);
+    for (size_t index = indexStart; index < indexStart + pagesCount; index++) {
+        entries[index] = reinterpret_cast<void *>(physAddress | entryBits);
+        physAddress += pageSize;
+    }
 }
 
 template class PageTable<class PDP, 3, 9>;
@@ -60,6 +60,9 @@ class PTE : public PageTable<void, 0u> {
 
     static const uint32_t level = 0;
     static const uint32_t bits = 9;
+
+  protected:
+    void reserveEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank);
 };
 
 class PDE : public PageTable<class PTE, 1> {
@@ -29,6 +29,10 @@ class PhysicalAddressAllocator {
         return reservePage(memoryBank, MemoryConstants::pageSize, MemoryConstants::pageSize);
     }
 
+    uint64_t reserve4kPages(uint32_t memoryBank, size_t pagesCount) {
+        return reservePage(memoryBank, pagesCount * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    }
+
     uint64_t reserve64kPage(uint32_t memoryBank) {
         return reservePage(memoryBank, MemoryConstants::pageSize64k, MemoryConstants::pageSize64k);
     }
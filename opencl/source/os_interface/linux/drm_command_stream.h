@@ -11,6 +11,7 @@
 
 #include "drm/i915_drm.h"
 
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -18,6 +19,7 @@ class BufferObject;
 class Drm;
 class DrmAllocation;
 class DrmMemoryManager;
+class DrmMemoryOperationsHandler;
 
 template <typename GfxFamily>
 class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
@@ -56,7 +58,23 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
   protected:
     MOCKABLE_VIRTUAL void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     MOCKABLE_VIRTUAL void exec(const BatchBuffer &batchBuffer, uint32_t vmHandleId, uint32_t drmContextId);
+    void updatePersistentResidency(DrmMemoryOperationsHandler &memoryOperationsInterface);
+    void rebuildPersistentBufferObjects(uint32_t vmHandleId);
 
+    // Allocations made resident through memory operations handler are kept at the front of residency
+    // and execObjectsStorage between submissions, they are rebuilt only when handler residency changes.
+    struct PersistentResidency {
+        uint64_t version = 0u;
+        std::unordered_set<GraphicsAllocation *> allocations;
+        std::unordered_set<BufferObject *> bufferObjects;
+        size_t bufferObjectsCount = 0u;
+        uint32_t vmHandleId = 0u;
+        uint32_t drmContextId = 0u;
+        bool bufferObjectsValid = true;
+        bool execObjectsFilled = false;
+    };
+
+    PersistentResidency persistentResidency;
     std::vector<BufferObject *> residency;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
     Drm *drm;
@@ -26,6 +26,7 @@
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -70,8 +71,16 @@ bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, Reside
 
     auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandler *>(this->executionEnvironment.rootDeviceEnvironments[this->rootDeviceIndex]->memoryOperationsInterface.get());
 
+    const bool usePersistentResidency = this->directSubmission.get() == nullptr && memoryOperationsInterface->isPersistentResidencySupported();
+    if (usePersistentResidency) {
+        // resident allocations are read under handler's lock, update before exec WA takes it
+        this->updatePersistentResidency(*memoryOperationsInterface);
+    }
+
     auto lock = memoryOperationsInterface->lockHandlerForExecWA();
-    memoryOperationsInterface->mergeWithResidencyContainer(this->osContext, allocationsForResidency);
+    if (!usePersistentResidency) {
+        memoryOperationsInterface->mergeWithResidencyContainer(this->osContext, allocationsForResidency);
+    }
 
     if (this->directSubmission.get()) {
         memoryOperationsInterface->makeResidentWithinOsContext(this->osContext, ArrayRef<GraphicsAllocation *>(&batchBuffer.commandBufferAllocation, 1), true);
@@ -101,11 +110,17 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
         execFlags |= (EXEC_OBJECT_ASYNC * DebugManager.flags.UseAsyncDrmExec.get());
     }
 
+    auto persistentCount = this->persistentResidency.bufferObjectsCount;
+    size_t prefilledCount = 0u;
+    if (this->persistentResidency.execObjectsFilled &&
+        this->persistentResidency.drmContextId == drmContextId &&
+        this->execObjectsStorage.size() > persistentCount) {
+        prefilledCount = persistentCount;
+    }
+
     // Residency hold all allocation except command buffer, hence + 1
     auto requiredSize = this->residency.size() + 1;
-    if (requiredSize > this->execObjectsStorage.size()) {
-        this->execObjectsStorage.resize(requiredSize);
-    }
+    this->execObjectsStorage.resize(requiredSize);
 
     int err = bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
                        batchBuffer.startOffset, execFlags,
@@ -114,18 +129,85 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
                        vmHandleId,
                        drmContextId,
                        this->residency.data(), this->residency.size(),
-                       this->execObjectsStorage.data());
+                       this->execObjectsStorage.data(),
+                       prefilledCount);
     UNRECOVERABLE_IF(err != 0);
 
-    this->residency.clear();
+    this->persistentResidency.execObjectsFilled = true;
+    this->persistentResidency.drmContextId = drmContextId;
+    this->residency.resize(persistentCount);
 }
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    if (!this->persistentResidency.bufferObjectsValid || this->persistentResidency.vmHandleId != handleId) {
+        this->rebuildPersistentBufferObjects(handleId);
+    }
+
+    auto &persistentAllocations = this->persistentResidency.allocations;
+    auto firstSubmissionBufferObject = this->residency.size();
     for (auto &alloc : inputAllocationsForResidency) {
+        if (!persistentAllocations.empty() && persistentAllocations.find(alloc) != persistentAllocations.end()) {
+            continue;
+        }
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
         drmAlloc->makeBOsResident(osContext, handleId, &this->residency, false);
     }
+
+    auto &persistentBufferObjects = this->persistentResidency.bufferObjects;
+    if (!persistentBufferObjects.empty()) {
+        // host ptr fragments and reusable BOs may be shared with persistent allocations
+        auto submissionEnd = std::remove_if(this->residency.begin() + firstSubmissionBufferObject, this->residency.end(),
+                                            [&persistentBufferObjects](BufferObject *bo) { return persistentBufferObjects.find(bo) != persistentBufferObjects.end(); });
+        this->residency.erase(submissionEnd, this->residency.end());
+    }
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::updatePersistentResidency(DrmMemoryOperationsHandler &memoryOperationsInterface) {
+    auto residencyVersion = memoryOperationsInterface.getResidencyVersion();
+    if (residencyVersion == this->persistentResidency.version) {
+        return;
+    }
+
+    ResidencyContainer residentAllocations;
+    memoryOperationsInterface.getResidentAllocations(residentAllocations);
+
+    this->persistentResidency.allocations.clear();
+    this->persistentResidency.allocations.insert(residentAllocations.begin(), residentAllocations.end());
+    this->persistentResidency.version = residencyVersion;
+    this->persistentResidency.bufferObjectsValid = false;
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::rebuildPersistentBufferObjects(uint32_t vmHandleId) {
+    std::vector<BufferObject *> bufferObjects;
+    for (auto &alloc : this->persistentResidency.allocations) {
+        auto drmAlloc = static_cast<DrmAllocation *>(alloc);
+        if (drmAlloc->fragmentsStorage.fragmentCount) {
+            for (auto fragmentId = 0u; fragmentId < drmAlloc->fragmentsStorage.fragmentCount; fragmentId++) {
+                auto bo = drmAlloc->fragmentsStorage.fragmentStorageData[fragmentId].osHandleStorage->bo;
+                if (bo) {
+                    bufferObjects.push_back(bo);
+                }
+            }
+        } else {
+            drmAlloc->bindBOs(osContext, vmHandleId, &bufferObjects, false);
+        }
+    }
+
+    this->residency.clear();
+    this->persistentResidency.bufferObjects.clear();
+    for (auto bo : bufferObjects) {
+        if (this->persistentResidency.bufferObjects.insert(bo).second) {
+            this->residency.push_back(bo);
+        }
+    }
+
+    this->persistentResidency.bufferObjectsCount = this->residency.size();
+    this->persistentResidency.vmHandleId = vmHandleId;
+    this->persistentResidency.bufferObjectsValid = true;
+    this->persistentResidency.execObjectsFilled = false;
 }
 
 template <typename GfxFamily>
@@ -134,8 +216,8 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
     // If flush wasn't called we need to make all objects non-resident.
     // If makeNonResident is called before flush, vector will be cleared.
     if (gfxAllocation.isResident(this->osContext->getContextId())) {
-        if (this->residency.size() != 0) {
-            this->residency.clear();
+        if (this->residency.size() > this->persistentResidency.bufferObjectsCount) {
+            this->residency.resize(this->persistentResidency.bufferObjectsCount);
         }
         for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
             gfxAllocation.fragmentsStorage.fragmentStorageData[fragmentId].residency->resident[osContext->getContextId()] = false;
@@ -118,6 +118,7 @@ cl_int Program::build(
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
             inputArgs.allowCaching = enableCaching;
+            inputArgs.allowMappedCachedBinary = true;
             NEO::TranslationOutput compilerOuput = {};
             auto compilerErr = pCompilerInterface->build(*this->pDevice, inputArgs, compilerOuput);
             this->updateBuildLog(this->pDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
@@ -131,7 +132,11 @@ cl_int Program::build(
                 this->irBinarySize = compilerOuput.intermediateRepresentation.size;
                 this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
             }
-            this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size);
+            if (compilerOuput.mappedDeviceBinary) {
+                this->replaceDeviceBinary(std::move(compilerOuput.mappedDeviceBinary));
+            } else {
+                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size);
+            }
             this->debugData = std::move(compilerOuput.debugData.mem);
             this->debugDataSize = compilerOuput.debugData.size;
         }
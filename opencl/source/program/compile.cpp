@@ -148,6 +148,7 @@ cl_int Program::compile(
         inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(compileData.data()), compileData.size());
         inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
         inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
+        inputArgs.allowCaching = (false == isKernelDebugEnabled());
 
         TranslationOutput compilerOuput;
         auto compilerErr = pCompilerInterface->compile(*this->pDevice, inputArgs, compilerOuput);
@@ -144,6 +144,7 @@ cl_int Program::link(
         inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
         inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
         inputArgs.GTPinInput = gtpinGetIgcInit();
+        inputArgs.allowCaching = (false == isKernelDebugEnabled());
 
         if (!isCreateLibrary) {
             inputArgs.outType = IGC::CodeType::oclGenBin;
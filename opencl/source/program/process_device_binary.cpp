@@ -121,7 +121,8 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, const
 }
 
 cl_int Program::processGenBinary() {
-    if (nullptr == this->unpackedDeviceBinary) {
+    auto blob = getUnpackedDeviceBinary();
+    if (blob.empty()) {
         return CL_INVALID_BINARY;
     }
 
@@ -136,7 +137,6 @@ cl_int Program::processGenBinary() {
     }
 
     ProgramInfo programInfo;
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
     SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     std::string decodeErrors;
@@ -157,6 +157,7 @@ cl_int Program::createProgramFromBinary(
     this->isSpirV = false;
     this->unpackedDeviceBinary.reset();
     this->unpackedDeviceBinarySize = 0U;
+    this->mappedDeviceBinary.reset();
     this->packedDeviceBinary.reset();
     this->packedDeviceBinarySize = 0U;
     this->createdFrom = CreatedFrom::BINARY;
@@ -240,7 +241,7 @@ cl_int Program::setProgramSpecializationConstant(cl_uint specId, size_t specSize
         }
 
         SpecConstantInfo specConstInfo;
-        auto retVal = pCompilerInterface->getSpecConstantsInfo(this->getDevice(), ArrayRef<const char>(irBinary.get(), irBinarySize), specConstInfo);
+        auto retVal = pCompilerInterface->getSpecConstantsInfo(this->getDevice(), ArrayRef<const char>(irBinary.get(), irBinarySize), specConstInfo, true);
 
         if (retVal != TranslationOutput::ErrorCode::Success) {
             return CL_INVALID_VALUE;
@@ -444,6 +445,7 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
 }
 
 void Program::replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize) {
+    this->mappedDeviceBinary.reset();
     if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
         this->packedDeviceBinary = std::move(newBinary);
         this->packedDeviceBinarySize = newBinarySize;
@@ -461,6 +463,31 @@ void Program::replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newB
     }
 }
 
+void Program::replaceDeviceBinary(std::unique_ptr<MappedFile> mappedBinary) {
+    auto binary = mappedBinary->getData();
+    if (isAnyPackedDeviceBinaryFormat(binary)) {
+        this->replaceDeviceBinary(makeCopy(binary.begin(), binary.size()), binary.size());
+        return;
+    }
+
+    // kernel infos reference the unpacked binary, so the mapping is kept alive together with the program
+    this->packedDeviceBinary.reset();
+    this->packedDeviceBinarySize = 0U;
+    this->unpackedDeviceBinary.reset();
+    this->unpackedDeviceBinarySize = 0U;
+    this->mappedDeviceBinary = std::move(mappedBinary);
+}
+
+ArrayRef<const uint8_t> Program::getUnpackedDeviceBinary() const {
+    if (nullptr != this->mappedDeviceBinary) {
+        return this->mappedDeviceBinary->getData();
+    }
+    if (nullptr == this->unpackedDeviceBinary) {
+        return {};
+    }
+    return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+}
+
 cl_int Program::packDeviceBinary() {
     if (nullptr != packedDeviceBinary) {
         return CL_SUCCESS;
@@ -469,12 +496,13 @@ cl_int Program::packDeviceBinary() {
     auto gfxCore = pDevice->getHardwareInfo().platform.eRenderCoreFamily;
     auto stepping = pDevice->getHardwareInfo().platform.usRevId;
 
-    if (nullptr != this->unpackedDeviceBinary.get()) {
+    auto unpackedDeviceBinary = getUnpackedDeviceBinary();
+    if (false == unpackedDeviceBinary.empty()) {
         SingleDeviceBinary singleDeviceBinary;
         singleDeviceBinary.buildOptions = this->options;
         singleDeviceBinary.targetDevice.coreFamily = gfxCore;
         singleDeviceBinary.targetDevice.stepping = stepping;
-        singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+        singleDeviceBinary.deviceBinary = unpackedDeviceBinary;
         singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
         singleDeviceBinary.debugData = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->debugData.get()), this->debugDataSize);
 
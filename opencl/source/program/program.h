@@ -271,6 +271,8 @@ class Program : public BaseObject<_cl_program> {
     }
 
     MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize);
+    void replaceDeviceBinary(std::unique_ptr<MappedFile> mappedBinary);
+    ArrayRef<const uint8_t> getUnpackedDeviceBinary() const;
 
   protected:
     MOCKABLE_VIRTUAL cl_int createProgramFromBinary(const void *pBinary, size_t binarySize);
@@ -302,6 +304,7 @@ class Program : public BaseObject<_cl_program> {
 
     std::unique_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
+    std::unique_ptr<MappedFile> mappedDeviceBinary;
 
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
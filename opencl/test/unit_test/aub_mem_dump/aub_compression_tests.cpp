@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_compression.h"
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+#include "test.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace AubMemDump;
+
+namespace {
+std::vector<char> compressAndDecompress(const std::vector<char> &data, size_t &compressedSize) {
+    std::vector<char> compressed(AubCompression::getMaxCompressedSize(data.size()));
+    compressedSize = AubCompression::compressBlock(data.data(), data.size(), compressed.data());
+    EXPECT_LE(compressedSize, compressed.size());
+
+    std::vector<char> decompressed(data.size());
+    EXPECT_TRUE(AubCompression::decompressBlock(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+    return decompressed;
+}
+
+std::vector<char> getRandomData(size_t size) {
+    std::mt19937 generator(0);
+    std::vector<char> data(size);
+    for (auto &value : data) {
+        value = static_cast<char>(generator());
+    }
+    return data;
+}
+} // namespace
+
+TEST(AubCompressionTest, givenZeroPagesWhenCompressedThenOutputIsSmallAndDecompressesToInput) {
+    std::vector<char> data(16 * 4096, 0);
+    size_t compressedSize = 0;
+
+    EXPECT_EQ(data, compressAndDecompress(data, compressedSize));
+    EXPECT_GT(data.size() / 100, compressedSize);
+}
+
+TEST(AubCompressionTest, givenRepeatedRecordsWhenCompressedThenOutputIsSmallerAndDecompressesToInput) {
+    std::vector<char> data;
+    for (uint32_t i = 0; i < 1024; i++) {
+        uint32_t record[] = {0x0e0a0000u, 0x1000u + i, 0x0u, 0x4u, 0xdeadbeefu};
+        data.insert(data.end(), reinterpret_cast<char *>(record), reinterpret_cast<char *>(record) + sizeof(record));
+    }
+    size_t compressedSize = 0;
+
+    EXPECT_EQ(data, compressAndDecompress(data, compressedSize));
+    EXPECT_GT(data.size() / 2, compressedSize);
+}
+
+TEST(AubCompressionTest, givenRandomDataWhenCompressedThenOutputDoesNotExceedMaxSizeAndDecompressesToInput) {
+    auto data = getRandomData(64 * 1024 + 7);
+    size_t compressedSize = 0;
+
+    EXPECT_EQ(data, compressAndDecompress(data, compressedSize));
+    EXPECT_GE(AubCompression::getMaxCompressedSize(data.size()), compressedSize);
+}
+
+TEST(AubCompressionTest, givenSmallInputsWhenCompressedThenTheyDecompressToInput) {
+    for (size_t size = 0; size < 32; size++) {
+        std::vector<char> data(size, 'a');
+        size_t compressedSize = 0;
+        EXPECT_EQ(data, compressAndDecompress(data, compressedSize));
+    }
+}
+
+TEST(AubCompressionTest, givenCorruptedOffsetWhenDecompressingThenFailureIsReturned) {
+    // one sequence with 4 literals followed by a match reaching before the start of output
+    const char compressed[] = {0x40, 'a', 'b', 'c', 'd', 0x10, 0x00, 0x10, 'e'};
+    std::vector<char> decompressed(13);
+
+    EXPECT_FALSE(AubCompression::decompressBlock(compressed, sizeof(compressed), decompressed.data(), decompressed.size()));
+}
+
+TEST(AubCompressionTest, givenCompressingWriterWhenDestroyedThenFileIsIndexedAndDecompressesToInput) {
+    auto data = getRandomData(1000);
+    data.resize(5000, 0);
+    std::ostringstream output;
+    {
+        AubFileWriter writer(output, 1024, true);
+        writer.write(data.data(), data.size());
+        writer.flush();
+    }
+    auto file = output.str();
+
+    ASSERT_LT(sizeof(AubCompression::FileHeader) + sizeof(AubCompression::IndexFooter), file.size());
+    EXPECT_EQ(0, memcmp(file.data(), AubCompression::fileMagic, sizeof(AubCompression::fileMagic)));
+
+    AubCompression::IndexFooter footer = {};
+    memcpy(&footer, file.data() + file.size() - sizeof(footer), sizeof(footer));
+    EXPECT_EQ(0, memcmp(footer.magic, AubCompression::indexMagic, sizeof(AubCompression::indexMagic)));
+    EXPECT_EQ(5u, footer.framesCount);
+    EXPECT_EQ(file.size(), footer.indexOffset + footer.framesCount * sizeof(AubCompression::IndexEntry) + sizeof(footer));
+
+    AubCompression::IndexEntry lastEntry = {};
+    memcpy(&lastEntry, file.data() + footer.indexOffset + 4 * sizeof(lastEntry), sizeof(lastEntry));
+    EXPECT_EQ(4096u, lastEntry.uncompressedOffset);
+
+    std::istringstream input(file);
+    std::ostringstream decompressed;
+    EXPECT_TRUE(AubCompression::decompressFile(input, decompressed));
+    EXPECT_EQ(std::string(data.data(), data.size()), decompressed.str());
+}
+
+TEST(AubCompressionTest, givenFileWithoutIndexWhenDecompressingThenCompleteFramesAreRestored) {
+    std::vector<char> data(3000, 'x');
+    std::ostringstream output;
+    AubCompression::FrameWriter frameWriter(output, 1024);
+    frameWriter.writeFrame(data.data(), 1024);
+    frameWriter.writeFrame(data.data() + 1024, 1024);
+
+    std::istringstream input(output.str());
+    std::ostringstream decompressed;
+    EXPECT_TRUE(AubCompression::decompressFile(input, decompressed));
+    EXPECT_EQ(std::string(2048, 'x'), decompressed.str());
+}
+
+TEST(AubCompressionTest, givenFileTruncatedInsideFrameWhenDecompressingThenCompleteFramesAreRestored) {
+    auto data = getRandomData(2048);
+    std::ostringstream output;
+    AubCompression::FrameWriter frameWriter(output, 1024);
+    frameWriter.writeFrame(data.data(), 1024);
+    auto firstFrameEnd = output.str().size();
+    frameWriter.writeFrame(data.data() + 1024, 1024);
+    auto file = output.str();
+
+    for (auto truncatedSize : {firstFrameEnd + sizeof(AubCompression::FrameHeader) / 2,
+                               firstFrameEnd + sizeof(AubCompression::FrameHeader) + 10,
+                               file.size() - 1}) {
+        std::istringstream input(file.substr(0, truncatedSize));
+        std::ostringstream decompressed;
+        EXPECT_TRUE(AubCompression::decompressFile(input, decompressed));
+        EXPECT_EQ(std::string(data.data(), 1024), decompressed.str());
+    }
+}
+
+TEST(AubCompressionTest, givenEmptyInputWhenCompressedThenOnlyTokenIsWrittenAndDecompressesToEmptyOutput) {
+    char compressed[16] = {};
+    auto compressedSize = AubCompression::compressBlock(nullptr, 0, compressed);
+    EXPECT_EQ(1u, compressedSize);
+
+    EXPECT_TRUE(AubCompression::decompressBlock(compressed, compressedSize, nullptr, 0));
+}
+
+TEST(AubCompressionTest, givenFileWithoutMagicWhenDecompressingThenFailureIsReturned) {
+    std::istringstream input(std::string(64, 'a'));
+    std::ostringstream decompressed;
+
+    EXPECT_FALSE(AubCompression::decompressFile(input, decompressed));
+}
+
+TEST(AubCompressionTest, DISABLED_profilingCompressAubLikeData) {
+    // memory writes of zero filled and partially filled pages mixed with random payload
+    std::vector<char> data;
+    auto randomData = getRandomData(AubFileWriter::defaultBufferSize);
+    for (size_t page = 0; data.size() < 256 * 1024 * 1024; page++) {
+        uint32_t header[] = {0x0e0a0000u, static_cast<uint32_t>(page * 4096), 0u, 4096u};
+        data.insert(data.end(), reinterpret_cast<char *>(header), reinterpret_cast<char *>(header) + sizeof(header));
+        auto payloadSize = (page % 4 == 0) ? 4096u : (page % 4) * 256u;
+        auto payload = randomData.begin() + (page * 4096) % (randomData.size() - 4096);
+        data.insert(data.end(), payload, payload + payloadSize);
+        data.insert(data.end(), 4096u - payloadSize, 0);
+    }
+    std::vector<char> compressed(AubCompression::getMaxCompressedSize(AubFileWriter::defaultBufferSize));
+    std::vector<char> decompressed(AubFileWriter::defaultBufferSize);
+    size_t processedTotal = 0;
+    size_t compressedTotal = 0;
+    std::chrono::high_resolution_clock::duration compressTime{}, decompressTime{};
+
+    for (size_t offset = 0; offset + AubFileWriter::defaultBufferSize <= data.size(); offset += AubFileWriter::defaultBufferSize) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto compressedSize = AubCompression::compressBlock(data.data() + offset, AubFileWriter::defaultBufferSize, compressed.data());
+        auto compressEnd = std::chrono::high_resolution_clock::now();
+        AubCompression::decompressBlock(compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+        auto end = std::chrono::high_resolution_clock::now();
+        compressTime += compressEnd - start;
+        decompressTime += end - compressEnd;
+        processedTotal += AubFileWriter::defaultBufferSize;
+        compressedTotal += compressedSize;
+    }
+    auto toMBps = [&](std::chrono::high_resolution_clock::duration time) {
+        return static_cast<double>(processedTotal) / (1024 * 1024) / std::chrono::duration<double>(time).count();
+    };
+    printf("ratio %.2f, compress %.0f MB/s, decompress %.0f MB/s\n", static_cast<double>(processedTotal) / compressedTotal,
+           toMBps(compressTime), toMBps(decompressTime));
+}
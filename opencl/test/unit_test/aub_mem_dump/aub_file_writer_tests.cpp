@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+#include "test.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace AubMemDump;
+
+TEST(AubFileWriterTest, givenDataSmallerThanBufferWhenWriterIsDrainedThenDataIsWrittenToOutput) {
+    std::ostringstream output;
+    AubFileWriter writer(output, 16, false);
+
+    writer.write("abc", 3);
+    writer.write("def", 3);
+    writer.drain();
+
+    EXPECT_EQ("abcdef", output.str());
+}
+
+TEST(AubFileWriterTest, givenDataLargerThanBufferWhenWriterIsDrainedThenDataIsWrittenInOrder) {
+    std::ostringstream output;
+    std::string expected;
+    AubFileWriter writer(output, 8, false);
+
+    for (char c = 'a'; c <= 'z'; c++) {
+        std::string chunk(static_cast<size_t>(c - 'a' + 1), c);
+        writer.write(chunk.c_str(), chunk.size());
+        expected += chunk;
+    }
+    writer.drain();
+
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(AubFileWriterTest, givenBufferedDataWhenWriterIsDestroyedThenDataIsWrittenToOutput) {
+    std::ostringstream output;
+    {
+        AubFileWriter writer(output, 16, false);
+        writer.write("abc", 3);
+        writer.flush();
+        writer.write("def", 3);
+    }
+
+    EXPECT_EQ("abcdef", output.str());
+}
+
+TEST(AubFileWriterTest, givenNoDataWhenWriterIsDrainedThenNothingIsWritten) {
+    std::ostringstream output;
+    AubFileWriter writer(output, 16, false);
+
+    writer.flush();
+    writer.drain();
+
+    EXPECT_TRUE(output.str().empty());
+}
+
+TEST(AubFileWriterTest, DISABLED_profilingWriteAubSizedRecordsToFile) {
+    const size_t recordSize = 64;
+    const size_t recordsPerFlush = 16 * 1024;
+    const size_t totalSize = 512 * 1024 * 1024;
+    std::string record(recordSize, 'x');
+    const char *fileName = "aub_file_writer_profiling.aub";
+
+    for (bool background : {false, true}) {
+        std::ofstream file(fileName, std::ofstream::binary);
+        std::unique_ptr<AubFileWriter> writer;
+        if (background) {
+            writer = std::make_unique<AubFileWriter>(file, AubFileWriter::defaultBufferSize, false);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t records = 1; records <= totalSize / recordSize; records++) {
+            if (writer) {
+                writer->write(record.c_str(), recordSize);
+            } else {
+                file.write(record.c_str(), recordSize);
+            }
+            if (records % recordsPerFlush == 0) {
+                if (writer) {
+                    writer->flush();
+                } else {
+                    file.flush();
+                }
+            }
+        }
+        auto submitted = std::chrono::high_resolution_clock::now();
+        writer.reset();
+        file.close();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        printf("%s: submitting thread %lld ms, total %lld ms\n", background ? "background writer" : "synchronous writes",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(submitted - start).count()),
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+    }
+    std::remove(fileName);
+}
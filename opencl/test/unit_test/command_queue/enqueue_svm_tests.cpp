@@ -1788,6 +1788,67 @@ HWTEST_F(UpdateResidencyContainerMultipleDevicesTest,
     EXPECT_EQ(0u, residencyContainer.size());
 }
 
+HWTEST_F(UpdateResidencyContainerMultipleDevicesTest,
+         givenUnchangedAllocationsWhenGettingIndirectResidencySnapshotAgainThenSameSnapshotIsReturned) {
+    uint32_t pCmdBuffer[1024];
+    MockGraphicsAllocation gfxAllocation(device->getDevice().getRootDeviceIndex(),
+                                         static_cast<void *>(pCmdBuffer), sizeof(pCmdBuffer));
+    SvmAllocationData allocData(maxRootDeviceIndex);
+    allocData.gpuAllocations.addAllocation(&gfxAllocation);
+    allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    allocData.device = &device->getDevice();
+
+    svmManager->insertSVMAlloc(allocData);
+
+    auto snapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                             InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, snapshot->allocations.size());
+    EXPECT_EQ(&gfxAllocation, snapshot->allocations[0]);
+
+    for (auto i = 0u; i < 3u; i++) {
+        auto nextSnapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                                     InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+        EXPECT_EQ(snapshot, nextSnapshot);
+        EXPECT_EQ(1u, nextSnapshot->allocations.size());
+    }
+
+    auto hostSnapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                                 InternalMemoryType::HOST_UNIFIED_MEMORY);
+    EXPECT_NE(snapshot, hostSnapshot);
+    EXPECT_EQ(0u, hostSnapshot->allocations.size());
+
+    svmManager->removeSVMAlloc(allocData);
+}
+
+HWTEST_F(UpdateResidencyContainerMultipleDevicesTest,
+         givenAllocationsChangedWhenGettingIndirectResidencySnapshotThenSnapshotIsRebuilt) {
+    uint32_t pCmdBuffer[1024];
+    MockGraphicsAllocation gfxAllocation(device->getDevice().getRootDeviceIndex(),
+                                         static_cast<void *>(pCmdBuffer), sizeof(pCmdBuffer));
+    SvmAllocationData allocData(maxRootDeviceIndex);
+    allocData.gpuAllocations.addAllocation(&gfxAllocation);
+    allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    allocData.device = &device->getDevice();
+
+    auto emptySnapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                                  InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    EXPECT_EQ(0u, emptySnapshot->allocations.size());
+
+    svmManager->insertSVMAlloc(allocData);
+    auto snapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                             InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    EXPECT_NE(emptySnapshot, snapshot);
+    EXPECT_LT(emptySnapshot->layoutVersion, snapshot->layoutVersion);
+    ASSERT_EQ(1u, snapshot->allocations.size());
+    EXPECT_EQ(&gfxAllocation, snapshot->allocations[0]);
+    EXPECT_EQ(0u, emptySnapshot->allocations.size());
+
+    svmManager->removeSVMAlloc(allocData);
+    snapshot = svmManager->getIndirectResidencySnapshot(device->getDevice().getRootDeviceIndex(),
+                                                        InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    EXPECT_EQ(0u, snapshot->allocations.size());
+}
+
 HWTEST_F(EnqueueSvmTest, GivenDstHostPtrWhenHostPtrAllocationCreationFailsThenReturnOutOfResource) {
     char dstHostPtr[260];
     void *pDstSVM = dstHostPtr;
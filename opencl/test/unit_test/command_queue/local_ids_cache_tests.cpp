@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_queue/local_id_gen.h"
+#include "opencl/source/command_queue/local_ids_cache.h"
+#include "test.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace NEO;
+
+struct MockLocalIdsCache : public LocalIdsCache {
+    using LocalIdsCache::entries;
+    using LocalIdsCache::LocalIdsCache;
+};
+
+struct LocalIdsCacheTest : public ::testing::Test {
+    bool setAndCompareWithGenerated(LocalIdsCache &cache, uint16_t simd, const std::array<uint16_t, 3> &groupSize,
+                                    const std::array<uint8_t, 3> &walkOrder, bool isImageOnlyKernel, uint32_t grfSize) {
+        auto size = LocalIdsCache::getLocalIdsSizeForGroup(simd, groupSize, grfSize);
+        auto expected = allocateAlignedMemory(size, 32);
+        auto actual = allocateAlignedMemory(size, 32);
+        memset(expected.get(), 0, size);
+        memset(actual.get(), 0xff, size);
+
+        generateLocalIDs(expected.get(), simd, groupSize, walkOrder, isImageOnlyKernel, grfSize);
+        cache.setLocalIdsForGroup(actual.get(), simd, groupSize, walkOrder, isImageOnlyKernel, grfSize);
+        return memcmp(expected.get(), actual.get(), size) == 0;
+    }
+
+    const std::array<uint8_t, 3> defaultWalkOrder{{0, 1, 2}};
+};
+
+TEST_F(LocalIdsCacheTest, givenDefaultCacheWhenCreatedThenDefaultCacheSizeIsUsed) {
+    LocalIdsCache cache;
+    EXPECT_EQ(LocalIdsCache::defaultCacheSize, cache.getCacheSize());
+}
+
+TEST_F(LocalIdsCacheTest, givenLocalIdsCacheSizeDebugFlagWhenCacheIsCreatedThenFlagValueIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.LocalIdsCacheSize.set(3);
+    LocalIdsCache cache;
+    EXPECT_EQ(3u, cache.getCacheSize());
+}
+
+TEST_F(LocalIdsCacheTest, givenGroupShapesWhenSettingLocalIdsThenPayloadMatchesGeneratedLocalIds) {
+    MockLocalIdsCache cache(LocalIdsCache::defaultCacheSize);
+
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 8, {{8, 4, 2}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{30, 3, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 32, {{64, 2, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 32, {{64, 2, 1}}, defaultWalkOrder, false, 64));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{4, 4, 1}}, {{1, 0, 2}}, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{4, 4, 1}}, defaultWalkOrder, true, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 1, {{3, 2, 1}}, defaultWalkOrder, false, 32));
+
+    EXPECT_EQ(7u, cache.entries.size());
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(7u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenSameGroupShapeWhenSettingLocalIdsAgainThenCachedPayloadIsCopied) {
+    MockLocalIdsCache cache(LocalIdsCache::defaultCacheSize);
+
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 2, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 2, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 2, 1}}, defaultWalkOrder, false, 32));
+
+    EXPECT_EQ(1u, cache.entries.size());
+    EXPECT_EQ(2u, cache.getHits());
+    EXPECT_EQ(1u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenFullCacheWhenSettingLocalIdsForNewShapeThenLeastRecentlyUsedShapeIsReplaced) {
+    MockLocalIdsCache cache(2u);
+
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 1, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{32, 1, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 1, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{48, 1, 1}}, defaultWalkOrder, false, 32));
+
+    ASSERT_EQ(2u, cache.entries.size());
+    EXPECT_EQ(16u, cache.entries[0].key.groupSize[0]);
+    EXPECT_EQ(48u, cache.entries[1].key.groupSize[0]);
+
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{32, 1, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_EQ(1u, cache.getHits());
+    EXPECT_EQ(4u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenDisabledCacheWhenSettingLocalIdsThenLocalIdsAreGeneratedInPlace) {
+    MockLocalIdsCache cache(0u);
+
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 2, 1}}, defaultWalkOrder, false, 32));
+    EXPECT_TRUE(setAndCompareWithGenerated(cache, 16, {{16, 2, 1}}, defaultWalkOrder, false, 32));
+
+    EXPECT_TRUE(cache.entries.empty());
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(0u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, DISABLED_profilingDispatchAlternatingGroupShapes) {
+    const std::array<std::array<uint16_t, 3>, 4> groupShapes = {{{{256, 1, 1}}, {{16, 16, 1}}, {{8, 8, 4}}, {{128, 2, 1}}}};
+    const uint16_t simd = 16;
+    const uint32_t grfSize = 32;
+    const uint32_t dispatches = 1000000u;
+
+    auto maxSize = LocalIdsCache::getLocalIdsSizeForGroup(simd, {{256, 1, 1}}, grfSize);
+    auto destination = allocateAlignedMemory(maxSize, 32);
+
+    for (auto cacheSize : {0u, 8u}) {
+        LocalIdsCache cache(cacheSize);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < dispatches; i++) {
+            cache.setLocalIdsForGroup(destination.get(), simd, groupShapes[i % groupShapes.size()], defaultWalkOrder, false, grfSize);
+        }
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << "local ids cache size: " << cacheSize << ", " << dispatches << " dispatches: " << time << " us" << std::endl;
+    }
+}
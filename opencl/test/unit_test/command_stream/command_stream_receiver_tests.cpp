@@ -43,6 +43,10 @@
 #include "command_stream_receiver_simulated_hw.h"
 #include "gmock/gmock.h"
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 using namespace NEO;
 
 struct CommandStreamReceiverTest : public ClDeviceFixture,
@@ -957,3 +961,52 @@ TEST_F(CommandStreamReceiverPageTableManagerTest, givenDefaultEngineTypeAndNonEx
 
     EXPECT_EQ(supportsPageTableManager, commandStreamReceiver.needsPageTableManager(defaultEngineType));
 }
+
+template <typename GfxFamily>
+struct FlushStampWaitingCsr : public UltCommandStreamReceiver<GfxFamily> {
+    using UltCommandStreamReceiver<GfxFamily>::UltCommandStreamReceiver;
+
+    bool waitForFlushStamp(FlushStamp &flushStampToWait) override {
+        waitedFlushStamps.push_back(flushStampToWait);
+        *this->getTagAddress() = taskCountAfterFlushStampWait;
+        return true;
+    }
+
+    std::vector<FlushStamp> waitedFlushStamps;
+    uint32_t taskCountAfterFlushStampWait = 0u;
+};
+
+HWTEST_F(CommandStreamReceiverTest, givenFlushStampWhenWaitingForCompletionWithoutTimeoutThenThisFlushStampIsWaitedFor) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+    FlushStampWaitingCsr<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+    csr.initializeTagAllocation();
+    *csr.getTagAddress() = 0u;
+    csr.latestFlushedTaskCount = 5u;
+    csr.taskCountAfterFlushStampWait = 5u;
+
+    EXPECT_TRUE(csr.waitForCompletionWithTimeout(false, 0, 5u, 123u));
+
+    ASSERT_EQ(1u, csr.waitedFlushStamps.size());
+    EXPECT_EQ(123u, csr.waitedFlushStamps[0]);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenUnknownFlushStampWhenWaitingForCompletionWithoutTimeoutThenFlushStampIsNotWaitedForAndTagIsPolled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+    FlushStampWaitingCsr<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+    csr.initializeTagAllocation();
+    *csr.getTagAddress() = 0u;
+    csr.latestFlushedTaskCount = 5u;
+
+    std::thread gpu([&csr]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        *csr.getTagAddress() = 5u;
+    });
+    EXPECT_TRUE(csr.waitForCompletionWithTimeout(false, 0, 5u, 0u));
+    gpu.join();
+
+    EXPECT_EQ(0u, csr.waitedFlushStamps.size());
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_stream/dirty_page_tracker.h"
+#include "opencl/test/unit_test/mocks/mock_aub_csr.h"
+#include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+struct DirtyPageTrackerTests : public ::testing::Test {
+    void SetUp() override {
+        memory = alignedMalloc(memorySize, MemoryConstants::pageSize);
+        memset(memory, 0, memorySize);
+    }
+    void TearDown() override {
+        alignedFree(memory);
+    }
+
+    const size_t memorySize = 4 * MemoryConstants::pageSize;
+    const uint64_t gpuAddress = 0x100000;
+    void *memory = nullptr;
+    DirtyPageTracker tracker;
+    DirtyPageTracker::ChangedRanges changedRanges;
+};
+
+TEST_F(DirtyPageTrackerTests, givenNotTrackedMemoryWhenFindingChangedRangesThenWholeMemoryIsReportedAsOneRange) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(0u, changedRanges[0].first);
+    EXPECT_EQ(memorySize, changedRanges[0].second);
+    EXPECT_EQ(memorySize, tracker.getBytesWritten());
+    EXPECT_EQ(0u, tracker.getBytesSkipped());
+    EXPECT_EQ(4u, tracker.getTrackedPagesCount());
+}
+
+TEST_F(DirtyPageTrackerTests, givenUnchangedMemoryWhenFindingChangedRangesAgainThenNothingIsReportedAndBytesAreSkipped) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    EXPECT_TRUE(changedRanges.empty());
+    EXPECT_EQ(memorySize, tracker.getBytesWritten());
+    EXPECT_EQ(memorySize, tracker.getBytesSkipped());
+}
+
+TEST_F(DirtyPageTrackerTests, givenChangesInAdjacentAndDistantPagesWhenFindingChangedRangesThenAdjacentPagesAreMergedIntoOneRange) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    static_cast<uint8_t *>(memory)[0] = 1;
+    static_cast<uint8_t *>(memory)[MemoryConstants::pageSize] = 1;
+    static_cast<uint8_t *>(memory)[3 * MemoryConstants::pageSize + 10] = 1;
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    ASSERT_EQ(2u, changedRanges.size());
+    EXPECT_EQ(0u, changedRanges[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, changedRanges[0].second);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, changedRanges[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize, changedRanges[1].second);
+    EXPECT_EQ(MemoryConstants::pageSize, tracker.getBytesSkipped());
+}
+
+TEST_F(DirtyPageTrackerTests, givenTrackedPageWhenDifferentPartOfThisPageIsWrittenThenItIsReportedAsChanged) {
+    tracker.findChangedRanges(gpuAddress, memory, MemoryConstants::pageSize, changedRanges);
+
+    tracker.findChangedRanges(gpuAddress + 0x100, ptrOffset(memory, 0x100), 0x100, changedRanges);
+
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(0u, changedRanges[0].first);
+    EXPECT_EQ(0x100u, changedRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTests, givenUnalignedRangeWhenFindingChangedRangesThenOffsetsAreRelativeToRangeStart) {
+    auto offset = MemoryConstants::pageSize / 2;
+    tracker.findChangedRanges(gpuAddress + offset, ptrOffset(memory, offset), 2 * MemoryConstants::pageSize, changedRanges);
+    EXPECT_EQ(3u, tracker.getTrackedPagesCount());
+
+    static_cast<uint8_t *>(memory)[2 * MemoryConstants::pageSize] = 1;
+    tracker.findChangedRanges(gpuAddress + offset, ptrOffset(memory, offset), 2 * MemoryConstants::pageSize, changedRanges);
+
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(MemoryConstants::pageSize + offset, changedRanges[0].first);
+    EXPECT_EQ(offset, changedRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTests, givenMemoryReadBackFromSimulatorWhenPagesAreUpdatedThenUnchangedContentIsNotWrittenAgain) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    memset(memory, 0xFF, memorySize);
+    tracker.updatePages(gpuAddress, memory, memorySize);
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    EXPECT_TRUE(changedRanges.empty());
+    EXPECT_EQ(memorySize, tracker.getBytesWritten());
+}
+
+TEST_F(DirtyPageTrackerTests, givenClearedPagesWhenFindingChangedRangesThenWholeMemoryIsReportedAgain) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    tracker.clearPages();
+    EXPECT_EQ(0u, tracker.getTrackedPagesCount());
+
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(memorySize, changedRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTests, givenRemovedRangeWhenFindingChangedRangesThenOnlyPagesOverlappingRemovedRangeAreReportedAgain) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    tracker.removePages(gpuAddress + MemoryConstants::pageSize + 0x10, 0x20);
+    EXPECT_EQ(3u, tracker.getTrackedPagesCount());
+
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(MemoryConstants::pageSize, changedRanges[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, changedRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTests, givenRemovedRangeLargerThanTrackedPagesWhenRemovingPagesThenOnlyPagesInRangeAreDropped) {
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+
+    tracker.removePages(gpuAddress - 16 * MemoryConstants::pageSize, 18 * MemoryConstants::pageSize);
+    EXPECT_EQ(2u, tracker.getTrackedPagesCount());
+
+    tracker.findChangedRanges(gpuAddress, memory, memorySize, changedRanges);
+    ASSERT_EQ(1u, changedRanges.size());
+    EXPECT_EQ(0u, changedRanges[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, changedRanges[0].second);
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrWithDirtyPageTrackingDisabledByDefaultWhenCreatedThenTrackerIsNotCreated) {
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    EXPECT_EQ(nullptr, aubCsr->dirtyPageTracker.get());
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingAllAllocationsWhenUnchangedAllocationIsWrittenAgainThenMemoryIsNotWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(2);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+    ASSERT_NE(nullptr, aubCsr->dirtyPageTracker.get());
+
+    MockGraphicsAllocation allocation(memory, gpuAddress, memorySize);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+
+    aubCsr->writeMemoryCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_FALSE(aubCsr->writeMemoryCalled);
+
+    static_cast<uint8_t *>(memory)[0] = 1;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+    EXPECT_EQ(memorySize + MemoryConstants::pageSize, aubCsr->dirtyPageTracker->getBytesWritten());
+    EXPECT_EQ(2 * memorySize - MemoryConstants::pageSize, aubCsr->dirtyPageTracker->getBytesSkipped());
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingGpuReadOnlyAllocationsWhenUnchangedBufferIsWrittenAgainThenMemoryIsWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(1);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    MockGraphicsAllocation allocation(memory, gpuAddress, memorySize);
+    allocation.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+
+    aubCsr->setAubWritable(true, allocation);
+    aubCsr->writeMemoryCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker->getTrackedPagesCount());
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingGpuReadOnlyAllocationsWhenUnchangedHeapIsWrittenAgainThenMemoryIsNotWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(1);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    MockGraphicsAllocation allocation(memory, gpuAddress, memorySize);
+    allocation.setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+
+    aubCsr->writeMemoryCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_FALSE(aubCsr->writeMemoryCalled);
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingGpuReadOnlyAllocationsWhenUntrackedAllocationIsWrittenToSameVaThenTrackedPagesAreDropped) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(1);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    MockGraphicsAllocation heap(memory, gpuAddress, memorySize);
+    heap.setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    EXPECT_TRUE(aubCsr->writeMemory(heap));
+    EXPECT_EQ(4u, aubCsr->dirtyPageTracker->getTrackedPagesCount());
+
+    MockGraphicsAllocation buffer(memory, gpuAddress, MemoryConstants::pageSize);
+    buffer.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_TRUE(aubCsr->writeMemory(buffer));
+    EXPECT_EQ(3u, aubCsr->dirtyPageTracker->getTrackedPagesCount());
+
+    aubCsr->writeMemoryCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(heap));
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+    EXPECT_EQ(memorySize + MemoryConstants::pageSize, aubCsr->dirtyPageTracker->getBytesWritten());
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingAllAllocationsWhenAllocationPagesAreInvalidatedThenAllocationAtSameVaIsWrittenAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(2);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    MockGraphicsAllocation allocation(memory, gpuAddress, memorySize);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+
+    aubCsr->invalidateAllocationPages(allocation);
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker->getTrackedPagesCount());
+
+    MockGraphicsAllocation reusedVaAllocation(memory, gpuAddress, memorySize);
+    aubCsr->writeMemoryCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(reusedVaAllocation));
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+    EXPECT_EQ(2 * memorySize, aubCsr->dirtyPageTracker->getBytesWritten());
+}
+
+HWTEST_F(DirtyPageTrackerTests, givenAubCsrTrackingAllAllocationsWhenExternalAllocationIsMadeNonResidentThenItsPagesAreDropped) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpChangedPagesOnly.set(2);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(false, false, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+
+    MockGraphicsAllocation allocation(memory, gpuAddress, memorySize);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+
+    AllocationView externalAllocation(gpuAddress, memorySize);
+    aubCsr->makeResidentExternal(externalAllocation);
+    aubCsr->makeNonResidentExternal(gpuAddress);
+
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker->getTrackedPagesCount());
+}
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/helpers/constants.h"
+
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "test.h"
 
@@ -13,4 +15,7 @@ TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(0u, cacheConfig.cacheSize);
+    EXPECT_EQ(32 * MemoryConstants::megaByte, cacheConfig.inMemoryCacheSize);
+    EXPECT_TRUE(cacheConfig.mapCachedBinaries);
 }
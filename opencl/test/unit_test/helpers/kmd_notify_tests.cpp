@@ -70,7 +70,7 @@ struct KmdNotifyTests : public ::testing::Test {
       public:
         MockKmdNotifyCsr(const ExecutionEnvironment &executionEnvironment) : UltCommandStreamReceiver<Family>(const_cast<ExecutionEnvironment &>(executionEnvironment), 0) {}
         MOCK_METHOD1(waitForFlushStamp, bool(FlushStamp &flushStampToWait));
-        MOCK_METHOD3(waitForCompletionWithTimeout, bool(bool enableTimeout, int64_t timeoutMs, uint32_t taskCountToWait));
+        MOCK_METHOD4(waitForCompletionWithTimeout, bool(bool enableTimeout, int64_t timeoutMs, uint32_t taskCountToWait, FlushStamp flushStampToWait));
     };
 
     template <typename Family>
@@ -96,7 +96,7 @@ struct KmdNotifyTests : public ::testing::Test {
 HWTEST_F(KmdNotifyTests, givenTaskCountWhenWaitUntilCompletionCalledThenAlwaysTryCpuPolling) {
     auto csr = createMockCsr<FamilyType>();
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, false);
 }
@@ -105,7 +105,7 @@ HWTEST_F(KmdNotifyTests, givenTaskCountAndKmdNotifyDisabledWhenWaitUntilCompleti
     overrideKmdNotifyParams(false, 0, false, 0, false, 0);
     auto csr = createMockCsr<FamilyType>();
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait, flushStampToWait)).Times(1).WillOnce(::testing::Return(true));
     EXPECT_CALL(*csr, waitForFlushStamp(::testing::_)).Times(0);
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, false);
@@ -116,9 +116,9 @@ HWTEST_F(KmdNotifyTests, givenNotReadyTaskCountWhenWaitUntilCompletionCalledThen
     *csr->getTagAddress() = taskCountToWait - 1;
 
     ::testing::InSequence is;
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait)).Times(1).WillOnce(::testing::Return(false));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(false));
     EXPECT_CALL(*csr, waitForFlushStamp(flushStampToWait)).Times(1).WillOnce(::testing::Return(true));
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait)).Times(1).WillOnce(::testing::Return(false));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(false));
 
     //we have unrecoverable for this case, this will throw.
     EXPECT_THROW(cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, false), std::exception);
@@ -128,7 +128,7 @@ HWTEST_F(KmdNotifyTests, givenReadyTaskCountWhenWaitUntilCompletionCalledThenTry
     auto csr = createMockCsr<FamilyType>();
 
     ::testing::InSequence is;
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
     EXPECT_CALL(*csr, waitForFlushStamp(::testing::_)).Times(0);
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, false);
@@ -138,7 +138,7 @@ HWTEST_F(KmdNotifyTests, givenDefaultArgumentWhenWaitUntilCompleteIsCalledThenDi
     auto csr = createMockCsr<FamilyType>();
     auto expectedTimeout = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, false);
 }
@@ -147,7 +147,7 @@ HWTEST_F(KmdNotifyTests, givenEnabledQuickSleepWhenWaitUntilCompleteIsCalledThen
     auto csr = createMockCsr<FamilyType>();
     auto expectedTimeout = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayQuickKmdSleepMicroseconds;
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, true);
 }
@@ -157,14 +157,14 @@ HWTEST_F(KmdNotifyTests, givenDisabledQuickSleepWhenWaitUntilCompleteWithQuickSl
     auto csr = createMockCsr<FamilyType>();
     auto expectedTimeout = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     cmdQ->waitUntilComplete(taskCountToWait, 0, flushStampToWait, true);
 }
 
 HWTEST_F(KmdNotifyTests, givenNotReadyTaskCountWhenPollForCompletionCalledThenTimeout) {
     *device->getDefaultEngine().commandStreamReceiver->getTagAddress() = taskCountToWait - 1;
-    auto success = device->getUltCommandStreamReceiver<FamilyType>().waitForCompletionWithTimeout(true, 1, taskCountToWait);
+    auto success = device->getUltCommandStreamReceiver<FamilyType>().waitForCompletionWithTimeout(true, 1, taskCountToWait, 0);
     EXPECT_FALSE(success);
 }
 
@@ -172,7 +172,7 @@ HWTEST_F(KmdNotifyTests, givenZeroFlushStampWhenWaitIsCalledThenDisableTimeout)
     auto csr = createMockCsr<FamilyType>();
 
     EXPECT_TRUE(device->getHardwareInfo().capabilityTable.kmdNotifyProperties.enableKmdNotify);
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, ::testing::_, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, ::testing::_, taskCountToWait, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
     EXPECT_CALL(*csr, waitForFlushStamp(::testing::_)).Times(0);
 
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 0, false, false);
@@ -183,7 +183,7 @@ HWTEST_F(KmdNotifyTests, givenNonQuickSleepRequestWhenItsSporadicWaitThenOverrid
     auto csr = createMockCsr<FamilyType>();
 
     auto expectedDelay = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayQuickKmdSleepMicroseconds;
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     int64_t timeSinceLastWait = mockKmdNotifyHelper->properties->delayQuickKmdSleepForSporadicWaitsMicroseconds + 1;
 
@@ -196,7 +196,7 @@ HWTEST_F(KmdNotifyTests, givenNonQuickSleepRequestWhenItsNotSporadicWaitThenOver
     auto csr = createMockCsr<FamilyType>();
 
     auto expectedDelay = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 1, false, false);
 }
@@ -204,14 +204,14 @@ HWTEST_F(KmdNotifyTests, givenNonQuickSleepRequestWhenItsNotSporadicWaitThenOver
 HWTEST_F(KmdNotifyTests, givenKmdNotifyDisabledWhenPowerSavingModeIsRequestedThenTimeoutIsEnabled) {
     overrideKmdNotifyParams(false, 3, false, 2, false, 9999999);
     auto csr = createMockCsr<FamilyType>();
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 1, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 1, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 1, false, true);
 }
 
 HWTEST_F(KmdNotifyTests, givenKmdNotifyDisabledWhenQueueHasPowerSavingModeAndCallWaitThenTimeoutIsEnabled) {
     overrideKmdNotifyParams(false, 3, false, 2, false, 9999999);
     auto csr = createMockCsr<FamilyType>();
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 1, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 1, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
     cmdQ->throttle = QueueThrottle::LOW;
     cmdQ->waitUntilComplete(1, 0, 1, false);
 }
@@ -219,7 +219,7 @@ HWTEST_F(KmdNotifyTests, givenKmdNotifyDisabledWhenQueueHasPowerSavingModeAndCal
 HWTEST_F(KmdNotifyTests, givenKmdNotifyDisabledWhenQueueHasPowerSavingModButThereIsNoFlushStampeAndCallWaitThenTimeoutIsDisabled) {
     overrideKmdNotifyParams(false, 3, false, 2, false, 9999999);
     auto csr = createMockCsr<FamilyType>();
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     cmdQ->throttle = QueueThrottle::LOW;
     cmdQ->waitUntilComplete(1, 0, 0, false);
@@ -230,7 +230,7 @@ HWTEST_F(KmdNotifyTests, givenQuickSleepRequestWhenItsSporadicWaitOptimizationIs
     auto csr = createMockCsr<FamilyType>();
 
     auto expectedDelay = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayQuickKmdSleepMicroseconds;
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, expectedDelay, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 1, true, false);
 }
@@ -241,7 +241,7 @@ HWTEST_F(KmdNotifyTests, givenTaskCountEqualToHwTagWhenWaitCalledThenDontMultipl
 
     auto expectedTimeout = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 1, false, false);
 }
@@ -252,7 +252,7 @@ HWTEST_F(KmdNotifyTests, givenTaskCountLowerThanHwTagWhenWaitCalledThenDontMulti
 
     auto expectedTimeout = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
 
-    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedTimeout, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
 
     csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, 1, false, false);
 }
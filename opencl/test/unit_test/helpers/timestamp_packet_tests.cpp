@@ -346,6 +346,18 @@ HWTEST_F(TimestampPacketTests, givenCommandStreamReceiverHwWhenObtainingPreferre
     EXPECT_EQ(2048u, csr.getPreferredTagPoolSize());
 }
 
+HWTEST_F(TimestampPacketTests, givenCommandStreamReceiverHwWhenObtainingPreferredTagMagazineSizeThenReturnCorrectValue) {
+    DebugManagerStateRestore restore;
+    CommandStreamReceiverHw<FamilyType> csr(*executionEnvironment, 0);
+    EXPECT_EQ(32u, csr.getPreferredTagMagazineSize());
+
+    DebugManager.flags.DisableTimestampPacketOptimizations.set(true);
+    EXPECT_EQ(0u, csr.getPreferredTagMagazineSize());
+
+    DebugManager.flags.TagAllocatorMagazineSize.set(8);
+    EXPECT_EQ(8u, csr.getPreferredTagMagazineSize());
+}
+
 HWTEST_F(TimestampPacketTests, givenDebugFlagSetWhenCreatingTimestampPacketAllocatorThenDisableReusingAndLimitPoolSize) {
     DebugManagerStateRestore restore;
     DebugManager.flags.DisableTimestampPacketOptimizations.set(true);
@@ -12,6 +12,8 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <cstdio>
 #include <memory>
 
 using namespace NEO;
@@ -67,7 +69,61 @@ TEST_F(AddressMapperTests, WhenUnmappingThenMappingWorksCorrectly) {
     mapper->unmap((void *)0x1000);
 
     mapper->unmap((void *)0x2000);
-    uint32_t m2 = mapper->map((void *)0x2000, MemoryConstants::pageSize);
-    EXPECT_NE(m1, m2);
-    EXPECT_EQ(0x2000u, m2);
+    uint32_t m2 = mapper->map((void *)0x3000, MemoryConstants::pageSize);
+    EXPECT_EQ(m1, m2);
+}
+
+TEST_F(AddressMapperTests, givenUnmappedRangeWhenSmallerRegionIsMappedThenFreedPagesAreReused) {
+    uint32_t m1 = mapper->map((void *)0x10000, 4 * MemoryConstants::pageSize);
+    uint32_t m2 = mapper->map((void *)0x20000, MemoryConstants::pageSize);
+    EXPECT_EQ(0x1000u, m1);
+    EXPECT_EQ(0x5000u, m2);
+
+    mapper->unmap((void *)0x10000);
+    EXPECT_EQ(0x1000u, mapper->map((void *)0x30000, MemoryConstants::pageSize));
+    EXPECT_EQ(0x2000u, mapper->map((void *)0x40000, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(0x4000u, mapper->map((void *)0x50000, MemoryConstants::pageSize));
+    EXPECT_EQ(0x6000u, mapper->map((void *)0x60000, MemoryConstants::pageSize));
+}
+
+TEST_F(AddressMapperTests, givenAdjacentUnmappedRangesWhenLargerRegionIsMappedThenMergedRangeIsReused) {
+    mapper->map((void *)0x10000, MemoryConstants::pageSize);
+    mapper->map((void *)0x20000, 2 * MemoryConstants::pageSize);
+    mapper->map((void *)0x30000, MemoryConstants::pageSize);
+    mapper->map((void *)0x40000, MemoryConstants::pageSize);
+
+    mapper->unmap((void *)0x30000);
+    mapper->unmap((void *)0x10000);
+    mapper->unmap((void *)0x20000);
+
+    EXPECT_EQ(0x1000u, mapper->map((void *)0x50000, 4 * MemoryConstants::pageSize));
+    EXPECT_EQ(0x6000u, mapper->map((void *)0x60000, MemoryConstants::pageSize));
+}
+
+TEST_F(AddressMapperTests, givenResizedMappingWhenNewRegionIsMappedThenPagesOfPreviousSizeAreReused) {
+    mapper->map((void *)0x10000, 2 * MemoryConstants::pageSize);
+    mapper->map((void *)0x20000, MemoryConstants::pageSize);
+    EXPECT_EQ(0x4000u, mapper->map((void *)0x10000, 3 * MemoryConstants::pageSize));
+
+    EXPECT_EQ(0x1000u, mapper->map((void *)0x30000, 2 * MemoryConstants::pageSize));
+}
+
+TEST_F(AddressMapperTests, DISABLED_profilingMapUnmapWithManyLiveMappings) {
+    const size_t liveMappings = 4096;
+    const size_t cycles = 100000;
+
+    for (size_t i = 0; i < liveMappings; i++) {
+        mapper->map(reinterpret_cast<void *>(0x100000 + i * MemoryConstants::pageSize * 4), MemoryConstants::pageSize);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < cycles; i++) {
+        auto vm = reinterpret_cast<void *>(0x80000000 + (i % 64) * MemoryConstants::pageSize * 4);
+        mapper->map(vm, (1 + i % 3) * MemoryConstants::pageSize);
+        mapper->unmap(vm);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ggtt = mapper->map(reinterpret_cast<void *>(0x70000000), MemoryConstants::pageSize);
+
+    printf("%zu map/unmap cycles with %zu live mappings: %lld us, next GGTT address 0x%x\n", cycles, liveMappings,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()), ggtt);
 }
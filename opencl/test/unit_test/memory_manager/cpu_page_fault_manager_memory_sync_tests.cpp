@@ -58,12 +58,12 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     cmdQ->device = device.get();
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
-    pageFaultManager->baseCpuTransfer(alloc, 10, cmdQ.get());
+    pageFaultManager->baseCpuTransfer(alloc, 0, 10, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 0);
     EXPECT_EQ(cmdQ->finishCalled, 0);
 
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 0, 256, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
@@ -93,7 +93,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 0);
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 0, 256, cmdQ.get());
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 1);
 
     svmAllocsManager->freeSVMAlloc(alloc);
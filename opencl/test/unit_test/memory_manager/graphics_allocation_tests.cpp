@@ -5,10 +5,17 @@
  *
  */
 
+#include "shared/source/memory_manager/residency.h"
+
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
 using namespace NEO;
 
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenAllInspectionIdsAreSetToZero) {
@@ -188,3 +195,73 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenQueryingUsedPageSizeThen
         EXPECT_EQ(MemoryConstants::pageSize64k, graphicsAllocation.getUsedPageSize());
     }
 }
+
+TEST(GraphicsAllocationTest, givenOsContextCountAboveInlineCapacityWhenAllocationIsCreatedThenUsageOfAllContextsIsTracked) {
+    constexpr size_t osContextCount = EngineLimits::maxInlineOsContextCount + 2;
+    MockGraphicsAllocation graphicsAllocation(0, GraphicsAllocation::AllocationType::UNKNOWN, nullptr, 0u, 0u, 0, MemoryPool::MemoryNull, osContextCount);
+    ASSERT_EQ(osContextCount, graphicsAllocation.usageInfos.size());
+
+    for (auto i = 0u; i < osContextCount; i++) {
+        EXPECT_EQ(MockGraphicsAllocation::objectNotUsed, graphicsAllocation.getTaskCount(i));
+        EXPECT_EQ(MockGraphicsAllocation::objectNotResident, graphicsAllocation.getResidencyTaskCount(i));
+        graphicsAllocation.updateTaskCount(i, i);
+        graphicsAllocation.updateResidencyTaskCount(i + 1, i);
+    }
+    for (auto i = 0u; i < osContextCount; i++) {
+        EXPECT_EQ(i, graphicsAllocation.getTaskCount(i));
+        EXPECT_EQ(i + 1, graphicsAllocation.getResidencyTaskCount(i));
+    }
+    EXPECT_TRUE(graphicsAllocation.isUsedByManyOsContexts());
+}
+
+TEST(ResidencyDataTest, givenOsContextCountAboveInlineCapacityWhenResidencyDataIsCreatedThenAllContextsAreNotResident) {
+    constexpr size_t osContextCount = EngineLimits::maxInlineOsContextCount + 2;
+    ResidencyData residency(osContextCount);
+    ASSERT_EQ(osContextCount, residency.resident.size());
+
+    for (auto i = 0u; i < osContextCount; i++) {
+        EXPECT_FALSE(residency.resident[i]);
+        EXPECT_EQ(0u, residency.getFenceValueForContextId(i));
+    }
+    residency.resident[osContextCount - 1] = true;
+    residency.updateCompletionData(5u, static_cast<uint32_t>(osContextCount - 1));
+    EXPECT_TRUE(residency.resident[osContextCount - 1]);
+    EXPECT_EQ(5u, residency.getFenceValueForContextId(static_cast<uint32_t>(osContextCount - 1)));
+}
+
+TEST(GraphicsAllocationTest, DISABLED_profilingFootprintOfManySmallAllocations) {
+    // single device engine set, allocations made resident in one context as USM slabs or timestamp tags usually are
+    constexpr size_t allocationsCount = 256 * 1024;
+    constexpr size_t osContextCount = 4;
+    constexpr uint32_t contextId = 1;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::unique_ptr<GraphicsAllocation>> allocations;
+    allocations.reserve(allocationsCount);
+    for (size_t i = 0; i < allocationsCount; i++) {
+        allocations.emplace_back(new GraphicsAllocation(0, GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, nullptr,
+                                                        i * MemoryConstants::pageSize, 0u, MemoryConstants::pageSize, MemoryPool::System4KBPages, osContextCount));
+    }
+    auto created = std::chrono::high_resolution_clock::now();
+
+    constexpr uint32_t residencyWalks = 64;
+    size_t residentCount = 0;
+    for (uint32_t taskCount = 1; taskCount <= residencyWalks; taskCount++) {
+        for (auto &allocation : allocations) {
+            if (allocation->isResidencyTaskCountBelow(taskCount, contextId)) {
+                allocation->updateResidencyTaskCount(taskCount, contextId);
+                residentCount++;
+            }
+        }
+    }
+    auto walked = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(allocationsCount * residencyWalks, residentCount);
+
+    auto toMs = [](std::chrono::high_resolution_clock::duration time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    };
+    printf("sizeof(GraphicsAllocation) %zu B, sizeof(ResidencyData) %zu B, %zu allocations: %.1f MB metadata, create %.1f ms, %u residency walks %.1f ms\n",
+           sizeof(GraphicsAllocation), sizeof(ResidencyData), allocationsCount,
+           static_cast<double>(sizeof(GraphicsAllocation) * allocationsCount) / (1024 * 1024),
+           toMs(created - start), residencyWalks, toMs(walked - created));
+}
@@ -15,6 +15,9 @@
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
+#include <chrono>
+#include <iostream>
+
 struct InternalAllocationStorageTest : public MemoryAllocatorFixture,
                                        public ::testing::Test {
     using MemoryAllocatorFixture::TearDown;
@@ -222,6 +225,127 @@ TEST_F(InternalAllocationStorageTest, givenAllocationWhenItIsPutOnReusableListWh
     EXPECT_EQ(nullptr, internalAllocation);
 }
 
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingThenOldestCompletedAllocationThatFitsIsReturned) {
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto secondBigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION, 3u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(secondBigAllocation), REUSABLE_ALLOCATION, 2u);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    *csr->getTagAddress() = 2u;
+
+    auto reusedAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(secondBigAllocation, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER));
+
+    auto reusedSmallAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedSmallAllocation.get());
+
+    EXPECT_TRUE(reusableAllocations.peekContains(*bigAllocation));
+    EXPECT_EQ(2u, reusableAllocations.getReuseHits());
+    EXPECT_EQ(1u, reusableAllocations.getReuseMisses());
+
+    *csr->getTagAddress() = 3u;
+    storage->cleanAllocationList(3u, REUSABLE_ALLOCATION);
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(reusedSmallAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenPartiallyCleanedReusableListWhenObtainingAllocationThenOnlyRemainingAllocationsAreReturned) {
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 5u);
+
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(busyAllocation, csr->getAllocationsForReuse().peekHead());
+
+    *csr->getTagAddress() = 5u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(busyAllocation, reusedAllocation.get());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsAboveMaxSizeWhenTrimmingThenOldestCompletedAllocationsAreReleased) {
+    auto oldestAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto newestAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(oldestAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(newestAllocation), REUSABLE_ALLOCATION, 2u);
+    *csr->getTagAddress() = 2u;
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    auto sizeBeforeTrim = reusableAllocations.getReusableSize();
+
+    storage->trimAllocationsForReuse(sizeBeforeTrim);
+    EXPECT_EQ(sizeBeforeTrim, reusableAllocations.getReusableSize());
+
+    storage->trimAllocationsForReuse(2 * oldestAllocation->getUnderlyingBufferSize());
+    EXPECT_FALSE(reusableAllocations.peekContains(*oldestAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*busyAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*newestAllocation));
+
+    storage->trimAllocationsForReuse(0u);
+    EXPECT_TRUE(reusableAllocations.peekContains(*busyAllocation));
+    EXPECT_FALSE(reusableAllocations.peekContains(*newestAllocation));
+    EXPECT_EQ(busyAllocation->getUnderlyingBufferSize(), reusableAllocations.getReusableSize());
+
+    *csr->getTagAddress() = 5u;
+    storage->cleanAllocationList(5u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(0u, reusableAllocations.getReusableSize());
+}
+
+TEST_F(InternalAllocationStorageTest, givenPrintAllocationReuseStatisticsFlagWhenStorageIsDestroyedThenHitsAndMissesArePrinted) {
+    DebugManagerStateRestore stateRestorer;
+    DebugManager.flags.PrintAllocationReuseStatistics.set(true);
+
+    auto allocationStorage = std::make_unique<InternalAllocationStorage>(*csr);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    allocationStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 0u);
+
+    auto reusedAllocation = allocationStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(nullptr, allocationStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    testing::internal::CaptureStdout();
+    allocationStorage.reset();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(std::string("Allocation reuse statistics: hits: 1, misses: 1\n"), output);
+}
+
+TEST_F(InternalAllocationStorageTest, DISABLED_profilingObtainReusableAllocationFromLongReuseList) {
+    const uint32_t reuseListLengths[] = {256u, 4096u};
+    const uint32_t iterations = 100000u;
+
+    for (auto reuseListLength : reuseListLengths) {
+        for (uint32_t i = 0; i < reuseListLength; i++) {
+            auto allocationType = (i % 4 == 0) ? GraphicsAllocation::AllocationType::INTERNAL_HEAP : GraphicsAllocation::AllocationType::BUFFER;
+            auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, (1 + i % 64) * MemoryConstants::pageSize, allocationType, mockDeviceBitfield});
+            storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, i);
+        }
+        *csr->getTagAddress() = reuseListLength;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            auto allocation = storage->obtainReusableAllocation(64 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+            storage->storeAllocationWithTaskCount(std::move(allocation), REUSABLE_ALLOCATION, reuseListLength);
+        }
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << "reuse list length: " << reuseListLength << ", " << iterations << " obtain/store pairs: " << time << " us" << std::endl;
+
+        storage->cleanAllocationList(reuseListLength, REUSABLE_ALLOCATION);
+    }
+}
+
 class WaitAtDeletionAllocation : public MockGraphicsAllocation {
   public:
     WaitAtDeletionAllocation(void *buffer, size_t sizeIn)
@@ -16,7 +16,9 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -172,15 +174,119 @@ TEST_F(PageTableTests48, WhenAssigningWalkerThenWalkIsExecutedCorrectly) {
 
     size_t walked = 0u;
     size_t lastOffset = 0;
+    uint32_t walkerCalls = 0u;
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         EXPECT_EQ(lastOffset, offset);
-        EXPECT_GE(pageSize, size);
 
         walked += size;
         lastOffset += size;
+        walkerCalls++;
     };
     pageTable->pageWalk(addr1, lSize, 0, 0, walker, MemoryBanks::MainBank);
     EXPECT_EQ(lSize, walked);
+    EXPECT_EQ(2u, walkerCalls);
+}
+
+TEST_F(PageTableTests48, givenPhysicallyContiguousPagesWhenPageWalkIsCalledThenWalkerIsCalledOnceForWholeExtent) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + 0x10;
+    size_t size = 16 * pageSize;
+    auto address = allocator.mainAllocator.load();
+
+    uint32_t walkerCalls = 0u;
+    PageWalker walker = [&](uint64_t physAddress, size_t walkedSize, size_t offset, uint64_t entryBits) {
+        EXPECT_EQ(address + 0x10, physAddress);
+        EXPECT_EQ(size, walkedSize);
+        EXPECT_EQ(0u, offset);
+        walkerCalls++;
+    };
+    pageTable->pageWalk(gpuVa, size, 0, 0, walker, MemoryBanks::MainBank);
+    EXPECT_EQ(1u, walkerCalls);
+}
+
+TEST_F(PageTableTests48, givenPhysicallyDiscontiguousPagesWhenPageWalkIsCalledThenWalkerIsCalledForEachExtent) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+    auto middlePageAddress = pageTable->map(gpuVa + pageSize, pageSize, 0, MemoryBanks::MainBank);
+
+    std::vector<uint64_t> walkedAddresses;
+    std::vector<size_t> walkedOffsets;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        EXPECT_EQ(pageSize, size);
+        walkedAddresses.push_back(physAddress);
+        walkedOffsets.push_back(offset);
+    };
+    pageTable->pageWalk(gpuVa, 3 * pageSize, 0, 0, walker, MemoryBanks::MainBank);
+
+    ASSERT_EQ(3u, walkedAddresses.size());
+    EXPECT_EQ(middlePageAddress + pageSize, walkedAddresses[0]);
+    EXPECT_EQ(middlePageAddress, walkedAddresses[1]);
+    EXPECT_EQ(middlePageAddress + 2 * pageSize, walkedAddresses[2]);
+    EXPECT_EQ(0u, walkedOffsets[0]);
+    EXPECT_EQ(pageSize, walkedOffsets[1]);
+    EXPECT_EQ(2 * pageSize, walkedOffsets[2]);
+}
+
+TEST_F(PageTableTests48, givenPagesWithDifferentEntryBitsWhenPageWalkIsCalledThenExtentIsSplit) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+    pageTable->map(gpuVa, pageSize, 0xabc, MemoryBanks::MainBank);
+    pageTable->map(gpuVa + pageSize, pageSize, 0x345, MemoryBanks::MainBank);
+
+    std::vector<uint64_t> walkedEntryBits;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        walkedEntryBits.push_back(entryBits);
+    };
+    pageTable->pageWalk(gpuVa, 2 * pageSize, 0, PageTableEntry::nonValidBits, walker, MemoryBanks::MainBank);
+
+    ASSERT_EQ(2u, walkedEntryBits.size());
+    EXPECT_EQ(0xabcu | 0x1, walkedEntryBits[0]);
+    EXPECT_EQ(0x345u, walkedEntryBits[1]);
+}
+
+TEST_F(PageTableTests48, givenNotMappedRangeWhenMappingThenPhysicalPagesAreReservedWithSingleAllocatorCall) {
+    struct CountingPhysicalAddressAllocator : MockPhysicalAddressAllocator {
+        uint64_t reservePage(uint32_t memoryBank, size_t pageSize, size_t alignement) override {
+            reservePageCalled++;
+            return MockPhysicalAddressAllocator::reservePage(memoryBank, pageSize, alignement);
+        }
+        uint32_t reservePageCalled = 0u;
+    } countingAllocator;
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&countingAllocator));
+    auto address = countingAllocator.mainAllocator.load();
+
+    auto physAddress = pageTable->map(refAddr, 10 * pageSize, 0, MemoryBanks::MainBank);
+
+    EXPECT_EQ(address, physAddress);
+    EXPECT_EQ(1u, countingAllocator.reservePageCalled);
+    EXPECT_EQ(address + 10 * pageSize, countingAllocator.mainAllocator.load());
+}
+
+TEST_F(PageTableTests48, DISABLED_profilingMapAndWalkOneGigabyteAllocation) {
+    if (!is64Bit) {
+        return;
+    }
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    const size_t size = 1ull << 30;
+
+    size_t walked = 0u;
+    uint32_t walkerCalls = 0u;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        walked += size;
+        walkerCalls++;
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    pageTable->map(refAddr, size, 0, MemoryBanks::MainBank);
+    auto mapped = std::chrono::high_resolution_clock::now();
+    pageTable->pageWalk(refAddr, size, 0, 0, walker, MemoryBanks::MainBank);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    EXPECT_EQ(size, walked);
+    printf("map: %lld us, page walk: %lld us, walker calls: %u\n",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(mapped - start).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - mapped).count()),
+           walkerCalls);
 }
 
 TEST_F(PageTableTests48, givenReservedPhysicalAddressWhenPageWalkIsCalledThenPageTablesAreFilledWithProperAddresses) {
@@ -25,6 +25,11 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
 using namespace NEO;
 
 template <bool enableLocalMemory>
@@ -487,6 +492,284 @@ TEST_F(SVMLocalMemoryAllocatorTest, whenGetSVMAllocationFromOutsideOfReturnedPoi
     svmManager->freeSVMAlloc(ptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, givenUnchangedAllocationsWhenLookingUpPointersRepeatedlyThenLookupSnapshotIsCachedByCallingThread) {
+    auto ptr = svmManager->createSVMAlloc(mockRootDeviceIndex, MemoryConstants::pageSize, {}, mockDeviceBitfield);
+    ASSERT_NE(nullptr, ptr);
+    auto &cacheEntry = svmManager->getThreadLookupCacheEntry();
+
+    SvmAllocationData *svmData = nullptr;
+    for (uint32_t i = 0; i < SVMAllocsManager::MapBasedAllocationTracker::lookupSnapshotRebuildThreshold - 1; i++) {
+        svmData = svmManager->getSVMAlloc(ptr);
+        EXPECT_EQ(nullptr, cacheEntry.snapshot.get());
+    }
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptr));
+    ASSERT_NE(nullptr, cacheEntry.snapshot.get());
+    EXPECT_EQ(1u, cacheEntry.snapshot->ranges.size());
+    EXPECT_EQ(svmManager->SVMAllocs.getLayoutVersion(), cacheEntry.snapshot->layoutVersion);
+    ASSERT_NE(nullptr, cacheEntry.lastHit);
+    EXPECT_EQ(svmData, cacheEntry.lastHit->allocData);
+
+    EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize - 1)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, -4)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(nullptr));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenCachedLookupSnapshotWhenAllocationIsFreedThenItIsNotReturnedByLookup) {
+    auto ptr = svmManager->createSVMAlloc(mockRootDeviceIndex, MemoryConstants::pageSize, {}, mockDeviceBitfield);
+    auto ptr2 = svmManager->createSVMAlloc(mockRootDeviceIndex, MemoryConstants::pageSize, {}, mockDeviceBitfield);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_NE(nullptr, ptr2);
+    for (uint32_t i = 0; i < SVMAllocsManager::MapBasedAllocationTracker::lookupSnapshotRebuildThreshold; i++) {
+        EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+    }
+    auto &cacheEntry = svmManager->getThreadLookupCacheEntry();
+    ASSERT_NE(nullptr, cacheEntry.snapshot.get());
+    auto cachedVersion = cacheEntry.snapshot->layoutVersion;
+
+    svmManager->freeSVMAlloc(ptr);
+
+    EXPECT_NE(cachedVersion, svmManager->SVMAllocs.getLayoutVersion());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr2));
+
+    svmManager->freeSVMAlloc(ptr2);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenTwoSvmManagersWhenLookingUpFromSameThreadThenEachManagerUsesItsOwnCacheEntry) {
+    auto secondSvmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get());
+    auto ptr = svmManager->createSVMAlloc(mockRootDeviceIndex, MemoryConstants::pageSize, {}, mockDeviceBitfield);
+    ASSERT_NE(nullptr, ptr);
+    for (uint32_t i = 0; i < SVMAllocsManager::MapBasedAllocationTracker::lookupSnapshotRebuildThreshold; i++) {
+        EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+        EXPECT_EQ(nullptr, secondSvmManager->getSVMAlloc(ptr));
+    }
+
+    auto &cacheEntry = svmManager->getThreadLookupCacheEntry();
+    auto &secondCacheEntry = secondSvmManager->getThreadLookupCacheEntry();
+    EXPECT_NE(&cacheEntry, &secondCacheEntry);
+    EXPECT_NE(cacheEntry.trackerId, secondCacheEntry.trackerId);
+    ASSERT_NE(nullptr, secondCacheEntry.snapshot.get());
+    EXPECT_EQ(0u, secondCacheEntry.snapshot->ranges.size());
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, DISABLED_profilingSvmPointerLookupWithManyLiveAllocations) {
+    constexpr size_t allocationsCount = 20000;
+    constexpr size_t lookupsCount = 2000000;
+    constexpr size_t threadsCount = 4;
+    constexpr uint64_t gpuBase = 0x100000000ull;
+
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    for (size_t i = 0; i < allocationsCount; i++) {
+        allocations.push_back(std::make_unique<MockGraphicsAllocation>(nullptr, gpuBase + i * MemoryConstants::pageSize64k, MemoryConstants::pageSize));
+        SvmAllocationData allocData(mockRootDeviceIndex);
+        allocData.gpuAllocations.addAllocation(allocations.back().get());
+        allocData.size = MemoryConstants::pageSize;
+        svmManager->insertSVMAlloc(allocData);
+    }
+    auto lookupPtr = [&](size_t lookup) {
+        return reinterpret_cast<void *>(gpuBase + ((lookup * 7919) % allocationsCount) * MemoryConstants::pageSize64k + 8);
+    };
+
+    auto runLookups = [&](bool useLookupSnapshot) {
+        std::atomic<size_t> hits{0};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t thread = 0; thread < threadsCount; thread++) {
+            threads.emplace_back([&]() {
+                size_t threadHits = 0;
+                for (size_t lookup = 0; lookup < lookupsCount / threadsCount; lookup++) {
+                    if (useLookupSnapshot) {
+                        threadHits += (svmManager->getSVMAlloc(lookupPtr(lookup)) != nullptr);
+                    } else {
+                        std::unique_lock<SpinLock> lock(svmManager->mtx);
+                        threadHits += (svmManager->SVMAllocs.get(lookupPtr(lookup)) != nullptr);
+                    }
+                }
+                hits += threadHits;
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+        EXPECT_EQ(lookupsCount, hits.load());
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+
+    auto mapLookupTime = runLookups(false);
+    auto snapshotLookupTime = runLookups(true);
+    std::cout << "allocations: " << allocationsCount << ", lookups: " << lookupsCount << ", threads: " << threadsCount << std::endl
+              << "locked map lookup: " << mapLookupTime << " us" << std::endl
+              << "snapshot lookup: " << snapshotLookupTime << " us" << std::endl;
+
+    for (auto &allocation : allocations) {
+        auto svmData = svmManager->getSVMAlloc(reinterpret_cast<void *>(allocation->getGpuAddress()));
+        ASSERT_NE(nullptr, svmData);
+        svmManager->removeSVMAlloc(*svmData);
+    }
+}
+
+struct UsmReusePoolTest : public SVMMemoryAllocatorTest {
+    void SetUp() override {
+        DebugManager.flags.EnableUsmAllocationReuse.set(1);
+        SVMMemoryAllocatorTest::SetUp();
+        deviceProperties.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+        deviceProperties.subdeviceBitfield = mockDeviceBitfield;
+        hostProperties.memoryType = InternalMemoryType::HOST_UNIFIED_MEMORY;
+        hostProperties.subdeviceBitfield = mockDeviceBitfield;
+    }
+
+    DebugManagerStateRestore restorer;
+    SVMAllocsManager::UnifiedMemoryProperties deviceProperties;
+    SVMAllocsManager::UnifiedMemoryProperties hostProperties;
+};
+
+TEST_F(UsmReusePoolTest, givenReuseDisabledWhenUsmAllocationIsFreedThenItIsReleasedToMemoryManager) {
+    DebugManager.flags.EnableUsmAllocationReuse.set(0);
+    MockSVMAllocsManager localSvmManager(memoryManager.get());
+    EXPECT_FALSE(localSvmManager.isUsmReuseEnabled());
+
+    auto ptr = localSvmManager.createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    localSvmManager.freeSVMAlloc(ptr);
+
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, localSvmManager.usmReusePool.entries.size());
+    EXPECT_EQ(0u, localSvmManager.getUsmReuseStatistics().misses);
+}
+
+TEST_F(UsmReusePoolTest, givenFreedDeviceAllocationWhenAllocatingSameSizeClassThenAllocationIsReused) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto gpuAllocation = svmManager->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex);
+
+    EXPECT_TRUE(svmManager->freeSVMAlloc(ptr));
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->getUsmReuseStatistics().pooledSize);
+
+    auto reusedPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 8192u, deviceProperties);
+    EXPECT_EQ(ptr, reusedPtr);
+    auto allocData = svmManager->getSVMAlloc(reusedPtr);
+    ASSERT_NE(nullptr, allocData);
+    EXPECT_EQ(gpuAllocation, allocData->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex));
+    EXPECT_EQ(8192u, allocData->size);
+    EXPECT_EQ(InternalMemoryType::DEVICE_UNIFIED_MEMORY, allocData->memoryType);
+
+    auto statistics = svmManager->getUsmReuseStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(0u, statistics.pooledSize);
+
+    svmManager->freeSVMAlloc(reusedPtr);
+}
+
+TEST_F(UsmReusePoolTest, givenFreedHostAllocationWhenAllocatingDeviceMemoryOfSameSizeThenPooledAllocationIsNotUsed) {
+    auto hostPtr = svmManager->createHostUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, hostProperties);
+    ASSERT_NE(nullptr, hostPtr);
+    svmManager->freeSVMAlloc(hostPtr);
+    EXPECT_EQ(1u, svmManager->usmReusePool.entries.size());
+
+    auto devicePtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, devicePtr);
+    EXPECT_EQ(1u, svmManager->usmReusePool.entries.size());
+    EXPECT_EQ(0u, svmManager->getUsmReuseStatistics().hits);
+
+    auto reusedHostPtr = svmManager->createHostUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, hostProperties);
+    EXPECT_EQ(hostPtr, reusedHostPtr);
+    EXPECT_EQ(1u, svmManager->getUsmReuseStatistics().hits);
+
+    svmManager->freeSVMAlloc(devicePtr);
+    svmManager->freeSVMAlloc(reusedHostPtr);
+}
+
+TEST_F(UsmReusePoolTest, givenPooledAllocationStillUsedByGpuWhenAllocatingThenNewAllocationIsCreated) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    svmManager->freeSVMAlloc(ptr);
+
+    memoryManager->forceAllocInUse = true;
+    auto newPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    EXPECT_NE(nullptr, newPtr);
+    EXPECT_NE(ptr, newPtr);
+    EXPECT_EQ(1u, memoryManager->allocInUseCalled);
+    EXPECT_EQ(1u, svmManager->usmReusePool.entries.size());
+    EXPECT_EQ(2u, svmManager->getUsmReuseStatistics().misses);
+
+    memoryManager->forceAllocInUse = false;
+    svmManager->freeSVMAlloc(newPtr);
+}
+
+TEST_F(UsmReusePoolTest, givenZeroIdleTimeoutWhenUsmAllocationIsFreedThenItIsReleasedImmediately) {
+    DebugManager.flags.UsmAllocationReuseIdleTimeout.set(0);
+    MockSVMAllocsManager localSvmManager(memoryManager.get());
+
+    auto ptr = localSvmManager.createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    localSvmManager.freeSVMAlloc(ptr);
+
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, localSvmManager.usmReusePool.entries.size());
+    EXPECT_EQ(1u, localSvmManager.getUsmReuseStatistics().releasedAllocations);
+    EXPECT_EQ(0u, localSvmManager.getUsmReuseStatistics().pooledSize);
+}
+
+TEST_F(UsmReusePoolTest, givenPoolExceedingMaxSizeWhenUsmAllocationIsFreedThenOldestAllocationIsReleased) {
+    DebugManager.flags.UsmAllocationReuseMaxSize.set(static_cast<int64_t>(MemoryConstants::pageSize64k));
+    MockSVMAllocsManager localSvmManager(memoryManager.get());
+
+    auto firstPtr = localSvmManager.createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    auto secondPtr = localSvmManager.createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, firstPtr);
+    ASSERT_NE(nullptr, secondPtr);
+    localSvmManager.freeSVMAlloc(firstPtr);
+    localSvmManager.freeSVMAlloc(secondPtr);
+
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    ASSERT_EQ(1u, localSvmManager.usmReusePool.entries.size());
+    EXPECT_EQ(secondPtr, localSvmManager.usmReusePool.entries.begin()->second.usmPtr);
+    EXPECT_EQ(MemoryConstants::pageSize64k, localSvmManager.getUsmReuseStatistics().pooledSize);
+}
+
+TEST_F(UsmReusePoolTest, givenPooledAllocationsWhenMemoryManagerFailsToAllocateThenPoolIsReleasedBeforeRetry) {
+    auto hostPtr = svmManager->createHostUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, hostProperties);
+    ASSERT_NE(nullptr, hostPtr);
+    svmManager->freeSVMAlloc(hostPtr);
+    EXPECT_EQ(1u, svmManager->usmReusePool.entries.size());
+
+    memoryManager->failInAllocateWithSizeAndAlignment = true;
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    EXPECT_EQ(nullptr, ptr);
+    EXPECT_EQ(0u, svmManager->usmReusePool.entries.size());
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(1u, svmManager->getUsmReuseStatistics().releasedAllocations);
+}
+
+TEST_F(UsmReusePoolTest, givenPrintAllocationReuseStatisticsFlagWhenSvmManagerIsDestroyedThenPoolIsReleasedAndStatisticsArePrinted) {
+    DebugManager.flags.PrintAllocationReuseStatistics.set(true);
+    auto localSvmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get());
+    auto ptr = localSvmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    localSvmManager->freeSVMAlloc(ptr);
+    ptr = localSvmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 4096u, deviceProperties);
+    localSvmManager->freeSVMAlloc(ptr);
+
+    testing::internal::CaptureStdout();
+    localSvmManager.reset();
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(std::string("USM allocation reuse pool: hits 1, misses 1, released 1\n"), output);
+}
+
 TEST_F(SVMLocalMemoryAllocatorTest, whenCouldNotAllocateCpuAllocationInMemoryManagerThenReturnsNullAndDoesNotChangeAllocsMap) {
     FailMemoryManager failMemoryManager(false, true, executionEnvironment);
     svmManager->memoryManager = &failMemoryManager;
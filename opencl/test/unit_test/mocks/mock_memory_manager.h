@@ -105,12 +105,21 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
 
     bool isCpuCopyRequired(const void *ptr) override { return cpuCopyRequired; }
 
+    bool allocInUse(GraphicsAllocation &graphicsAllocation) override {
+        allocInUseCalled++;
+        if (forceAllocInUse) {
+            return true;
+        }
+        return OsAgnosticMemoryManager::allocInUse(graphicsAllocation);
+    }
+
     GraphicsAllocation *allocate32BitGraphicsMemory(uint32_t rootDeviceIndex, size_t size, const void *ptr, GraphicsAllocation::AllocationType allocationType);
     GraphicsAllocation *allocate32BitGraphicsMemoryImpl(const AllocationData &allocationData, bool useLocalMemory) override;
 
     void forceLimitedRangeAllocator(uint32_t rootDeviceIndex, uint64_t range) { getGfxPartition(rootDeviceIndex)->init(range, 0, 0, gfxPartitions.size()); }
 
     uint32_t freeGraphicsMemoryCalled = 0u;
+    uint32_t allocInUseCalled = 0u;
     uint32_t unlockResourceCalled = 0u;
     uint32_t lockResourceCalled = 0u;
     uint32_t handleFenceCompletionCalled = 0u;
@@ -127,6 +136,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     bool failAllocateSystemMemory = false;
     bool failAllocate32Bit = false;
     bool cpuCopyRequired = false;
+    bool forceAllocInUse = false;
     bool forceRenderCompressed = false;
     std::unique_ptr<MockExecutionEnvironment> mockExecutionEnvironment;
     DeviceBitfield recentlyPassedDeviceBitfield{};
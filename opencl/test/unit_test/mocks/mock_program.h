@@ -47,6 +47,7 @@ class MockProgram : public Program {
     using Program::irBinary;
     using Program::irBinarySize;
     using Program::isSpirV;
+    using Program::mappedDeviceBinary;
     using Program::options;
     using Program::packDeviceBinary;
     using Program::packedDeviceBinary;
@@ -10,9 +10,12 @@
 namespace NEO {
 struct MockSVMAllocsManager : SVMAllocsManager {
 
+    using SVMAllocsManager::getThreadLookupCacheEntry;
     using SVMAllocsManager::memoryManager;
+    using SVMAllocsManager::mtx;
     using SVMAllocsManager::SVMAllocs;
     using SVMAllocsManager::SVMAllocsManager;
     using SVMAllocsManager::svmMapOperations;
+    using SVMAllocsManager::usmReusePool;
 };
 } // namespace NEO
\ No newline at end of file
@@ -21,6 +21,9 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <iostream>
+
 using namespace NEO;
 
 TEST(DrmMemoryManagerSimpleTest, givenDrmMemoryManagerWhenAllocateInDevicePoolIsCalledThenNullptrAndStatusRetryIsReturned) {
@@ -133,6 +136,28 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenMakeAllBuffersResidentSetW
     mm->freeGraphicsMemory(commandBuffer);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenMakeAllBuffersResidentSetAndAllocInMemoryOperationsInterfaceWhenFlushThenPersistentResidencyIsUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.MakeAllBuffersResident.set(true);
+
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&allocation, 1));
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(1u, testedCsr->persistentResidency.allocations.count(allocation));
+    EXPECT_EQ(1u, testedCsr->persistentResidency.bufferObjectsCount);
+
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInterfaceWhenFlushThenAllocIsResident) {
     auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
     LinearStream cs(commandBuffer);
@@ -172,6 +197,138 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInt
     mm->freeGraphicsMemory(commandBuffer);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInterfaceWhenFlushingTwiceThenExecObjectIsFilledOnlyOnce) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&allocation, 1));
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    auto &execStorage = testedCsr->getExecStorage();
+    ASSERT_EQ(2u, execStorage.size());
+    EXPECT_EQ(static_cast<DrmAllocation *>(allocation)->getBO()->peekHandle(), static_cast<int>(execStorage[0].handle));
+    EXPECT_EQ(1u, testedCsr->persistentResidency.bufferObjectsCount);
+    EXPECT_EQ(1u, testedCsr->residency.size());
+    EXPECT_TRUE(csr->getResidencyAllocations().empty());
+
+    constexpr uint64_t marker = 0xabcdu;
+    execStorage[0].rsvd2 = marker;
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    ASSERT_EQ(2u, execStorage.size());
+    EXPECT_EQ(marker, execStorage[0].rsvd2);
+    EXPECT_EQ(1u, testedCsr->residency.size());
+
+    executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface->evict(device.get(), *allocation);
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(1u, execStorage.size());
+    EXPECT_EQ(0u, testedCsr->persistentResidency.bufferObjectsCount);
+    EXPECT_TRUE(testedCsr->residency.empty());
+
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInterfaceAndInCsrResidencyWhenFlushThenBufferObjectIsSubmittedOnce) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    auto persistentAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto submissionAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&persistentAllocation, 1));
+
+    csr->makeResident(*persistentAllocation);
+    csr->makeResident(*submissionAllocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    auto &execStorage = testedCsr->getExecStorage();
+    ASSERT_EQ(3u, execStorage.size());
+    EXPECT_EQ(static_cast<DrmAllocation *>(persistentAllocation)->getBO()->peekHandle(), static_cast<int>(execStorage[0].handle));
+    EXPECT_EQ(static_cast<DrmAllocation *>(submissionAllocation)->getBO()->peekHandle(), static_cast<int>(execStorage[1].handle));
+    EXPECT_EQ(1u, testedCsr->residency.size());
+
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    mm->freeGraphicsMemory(persistentAllocation);
+    mm->freeGraphicsMemory(submissionAllocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenPersistentDrmResidencyDisabledWhenFlushThenHandlerResidencyIsMergedIntoSubmission) {
+    DebugManager.flags.EnablePersistentDrmResidency.set(0);
+
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&allocation, 1));
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    EXPECT_EQ(2u, testedCsr->getExecStorage().size());
+    EXPECT_EQ(0u, testedCsr->persistentResidency.bufferObjectsCount);
+    EXPECT_TRUE(testedCsr->residency.empty());
+    ASSERT_EQ(1u, csr->getResidencyAllocations().size());
+    EXPECT_EQ(allocation, csr->getResidencyAllocations()[0]);
+
+    csr->getResidencyAllocations().clear();
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, DISABLED_profilingFlushWithManyAllocationsInMemoryOperationsInterface) {
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    auto memoryOperationsInterface = executionEnvironment->rootDeviceEnvironments[csr->getRootDeviceIndex()]->memoryOperationsInterface.get();
+    constexpr size_t flushCount = 1000u;
+
+    for (auto residentCount : {16u, 256u, 4096u}) {
+        std::vector<GraphicsAllocation *> allocations;
+        for (auto i = 0u; i < residentCount; i++) {
+            allocations.push_back(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
+        }
+        memoryOperationsInterface->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(allocations.data(), allocations.size()));
+
+        for (auto persistentResidency : {0, 1}) {
+            DebugManager.flags.EnablePersistentDrmResidency.set(persistentResidency);
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t flush = 0u; flush < flushCount; flush++) {
+                csr->flush(batchBuffer, csr->getResidencyAllocations());
+                csr->getResidencyAllocations().clear();
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "resident allocations: " << residentCount << ", persistent residency: " << persistentResidency
+                      << ", flush time: " << static_cast<double>(elapsed) / flushCount << " us" << std::endl;
+        }
+
+        for (auto allocation : allocations) {
+            memoryOperationsInterface->evict(device.get(), *allocation);
+            mm->freeGraphicsMemory(allocation);
+        }
+    }
+
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
 TEST(ResidencyTests, whenBuffersIsCreatedWithMakeResidentFlagThenItSuccessfulyCreates) {
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
     ultHwConfig.useMockedPrepareDeviceEnvironmentsFunc = false;
@@ -6,11 +6,15 @@
  */
 
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_default.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -47,3 +51,74 @@ TEST_F(DrmMemoryOperationsHandlerBaseTest, whenEvictingResidentAllocationExpectE
     EXPECT_EQ(drmMemoryOperationsHandler->isResident(nullptr, graphicsAllocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
     EXPECT_EQ(drmMemoryOperationsHandler->residency.size(), 0u);
 }
+
+TEST_F(DrmMemoryOperationsHandlerBaseTest, whenResidencySetChangesThenResidencyVersionIsIncremented) {
+    auto initialVersion = drmMemoryOperationsHandler->getResidencyVersion();
+
+    drmMemoryOperationsHandler->makeResident(nullptr, ArrayRef<GraphicsAllocation *>(&allocationPtr, 1));
+    auto versionAfterMakeResident = drmMemoryOperationsHandler->getResidencyVersion();
+    EXPECT_NE(initialVersion, versionAfterMakeResident);
+
+    drmMemoryOperationsHandler->makeResident(nullptr, ArrayRef<GraphicsAllocation *>(&allocationPtr, 1));
+    EXPECT_EQ(versionAfterMakeResident, drmMemoryOperationsHandler->getResidencyVersion());
+
+    drmMemoryOperationsHandler->evict(nullptr, graphicsAllocation);
+    auto versionAfterEvict = drmMemoryOperationsHandler->getResidencyVersion();
+    EXPECT_NE(versionAfterMakeResident, versionAfterEvict);
+
+    drmMemoryOperationsHandler->evict(nullptr, graphicsAllocation);
+    EXPECT_EQ(versionAfterEvict, drmMemoryOperationsHandler->getResidencyVersion());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBaseTest, givenResidentAllocationWhenGettingResidentAllocationsThenAllocationIsReturned) {
+    drmMemoryOperationsHandler->makeResident(nullptr, ArrayRef<GraphicsAllocation *>(&allocationPtr, 1));
+
+    ResidencyContainer residentAllocations;
+    drmMemoryOperationsHandler->getResidentAllocations(residentAllocations);
+    ASSERT_EQ(1u, residentAllocations.size());
+    EXPECT_EQ(allocationPtr, residentAllocations[0]);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBaseTest, givenHandlerLockedWhenGettingResidentAllocationsThenSnapshotIsTakenAfterUnlock) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.MakeAllBuffersResident.set(1);
+    drmMemoryOperationsHandler->makeResident(nullptr, ArrayRef<GraphicsAllocation *>(&allocationPtr, 1));
+
+    auto lock = drmMemoryOperationsHandler->lockHandlerForExecWA();
+    ASSERT_TRUE(lock.owns_lock());
+
+    std::atomic<bool> snapshotTaken{false};
+    ResidencyContainer residentAllocations;
+    std::thread reader([&]() {
+        drmMemoryOperationsHandler->getResidentAllocations(residentAllocations);
+        snapshotTaken = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(snapshotTaken);
+
+    lock.unlock();
+    reader.join();
+    EXPECT_TRUE(snapshotTaken);
+    ASSERT_EQ(1u, residentAllocations.size());
+    EXPECT_EQ(allocationPtr, residentAllocations[0]);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBaseTest, givenAllocationAlreadyInResidencyContainerWhenMergingThenAllocationIsNotDuplicated) {
+    MockGraphicsAllocation otherAllocation;
+    GraphicsAllocation *allocations[] = {allocationPtr, &otherAllocation};
+    drmMemoryOperationsHandler->makeResident(nullptr, ArrayRef<GraphicsAllocation *>(allocations, 2));
+
+    ResidencyContainer residencyContainer = {allocationPtr};
+    drmMemoryOperationsHandler->mergeWithResidencyContainer(nullptr, residencyContainer);
+    ASSERT_EQ(2u, residencyContainer.size());
+    EXPECT_EQ(allocationPtr, residencyContainer[0]);
+    EXPECT_EQ(&otherAllocation, residencyContainer[1]);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBaseTest, givenPersistentDrmResidencyDebugFlagWhenCheckingSupportThenFlagIsRespected) {
+    DebugManagerStateRestore restorer;
+    EXPECT_TRUE(drmMemoryOperationsHandler->isPersistentResidencySupported());
+
+    DebugManager.flags.EnablePersistentDrmResidency.set(0);
+    EXPECT_FALSE(drmMemoryOperationsHandler->isPersistentResidencySupported());
+}
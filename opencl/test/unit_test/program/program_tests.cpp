@@ -14,6 +14,7 @@
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -2829,7 +2830,8 @@ struct SpecializationConstantCompilerInterfaceMock : public CompilerInterface {
     TranslationOutput::ErrorCode retVal = TranslationOutput::ErrorCode::Success;
     int counter = 0;
     const char *spirV = nullptr;
-    TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output) override {
+    TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output,
+                                                      bool allowCaching) override {
         counter++;
         spirV = srcSpirV.begin();
         return retVal;
@@ -3116,6 +3118,64 @@ TEST(ProgramReplaceDeviceBinary, GivenBinaryZebinThenUseAsBothPackedAndUnpackedB
     EXPECT_EQ(0, memcmp(program.unpackedDeviceBinary.get(), zebin.storage.data(), program.unpackedDeviceBinarySize));
 }
 
+TEST(ProgramReplaceDeviceBinary, GivenMappedPatchtokensBinaryThenMappingIsUsedAsUnpackedBinaryWithoutCopy) {
+    MockExecutionEnvironment execEnv;
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    const char *fileName = "program_replace_device_binary_mapped.tmp";
+    writeDataToFile(fileName, programTokens.storage.data(), programTokens.storage.size());
+    auto mappedBinary = MappedFile::openReadOnly(fileName);
+    ASSERT_NE(nullptr, mappedBinary);
+    auto mappedData = mappedBinary->getData();
+
+    MockProgram program{execEnv};
+    program.replaceDeviceBinary(makeCopy(programTokens.storage.data(), programTokens.storage.size()), programTokens.storage.size());
+    program.replaceDeviceBinary(std::move(mappedBinary));
+    EXPECT_EQ(nullptr, program.unpackedDeviceBinary);
+    EXPECT_EQ(0U, program.unpackedDeviceBinarySize);
+    EXPECT_EQ(nullptr, program.packedDeviceBinary);
+    ASSERT_NE(nullptr, program.mappedDeviceBinary);
+    EXPECT_EQ(mappedData.begin(), program.getUnpackedDeviceBinary().begin());
+    EXPECT_EQ(mappedData.size(), program.getUnpackedDeviceBinary().size());
+
+    program.replaceDeviceBinary(makeCopy(programTokens.storage.data(), programTokens.storage.size()), programTokens.storage.size());
+    EXPECT_EQ(nullptr, program.mappedDeviceBinary);
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(program.unpackedDeviceBinary.get()), program.getUnpackedDeviceBinary().begin());
+    std::remove(fileName);
+}
+
+TEST(ProgramReplaceDeviceBinary, GivenMappedZebinThenBinaryIsCopiedToPackedAndUnpackedBinaryContainers) {
+    MockExecutionEnvironment execEnv;
+    ZebinTestData::ValidEmptyProgram zebin;
+    const char *fileName = "program_replace_device_binary_mapped_zebin.tmp";
+    writeDataToFile(fileName, zebin.storage.data(), zebin.storage.size());
+    auto mappedBinary = MappedFile::openReadOnly(fileName);
+    ASSERT_NE(nullptr, mappedBinary);
+
+    MockProgram program{execEnv};
+    program.replaceDeviceBinary(std::move(mappedBinary));
+    EXPECT_EQ(nullptr, program.mappedDeviceBinary);
+    ASSERT_NE(nullptr, program.packedDeviceBinary);
+    ASSERT_NE(nullptr, program.unpackedDeviceBinary);
+    EXPECT_EQ(zebin.storage.size(), program.unpackedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(program.unpackedDeviceBinary.get(), zebin.storage.data(), program.unpackedDeviceBinarySize));
+    std::remove(fileName);
+}
+
+TEST(ProgramReplaceDeviceBinary, GivenMappedBinaryWhenProcessingGenBinaryThenKernelsAreDecodedFromMapping) {
+    PatchTokensTestData::ValidProgramWithKernel programTokens;
+    const char *fileName = "program_process_mapped_device_binary.tmp";
+    writeDataToFile(fileName, programTokens.storage.data(), programTokens.storage.size());
+
+    MockExecutionEnvironment execEnv;
+    MockProgram program{execEnv};
+    program.replaceDeviceBinary(MappedFile::openReadOnly(fileName));
+    ASSERT_NE(nullptr, program.mappedDeviceBinary);
+
+    EXPECT_EQ(CL_SUCCESS, program.processGenBinary());
+    EXPECT_EQ(1U, program.getNumKernels());
+    std::remove(fileName);
+}
+
 TEST(Program, WhenSettingProgramReleaseCallbackThenCallOrderIsPreserved) {
     struct UserDataType {
         cl_program expectedProgram;
@@ -16,7 +16,11 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
 #include <cstdint>
+#include <iostream>
+#include <thread>
+#include <unordered_set>
 
 using namespace NEO;
 
@@ -52,9 +56,12 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using TagNodeT = TagNode<TagType>;
 
   public:
+    using BaseClass::allocatorMutex;
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::getThreadMagazine;
+    using BaseClass::magazines;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::usedTags;
@@ -63,6 +70,10 @@ class MockTagAllocator : public TagAllocator<TagType> {
         : BaseClass(0, memMngr, tagCount, tagAlignment, sizeof(TagType), disableCompletionCheck, deviceBitfield) {
     }
 
+    MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, DeviceBitfield deviceBitfield, size_t magazineSize, bool trackUsedTags)
+        : BaseClass(0, memMngr, tagCount, tagAlignment, sizeof(TagType), false, deviceBitfield, magazineSize, trackUsedTags) {
+    }
+
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, DeviceBitfield deviceBitfield)
         : MockTagAllocator(memMngr, tagCount, tagAlignment, false, deviceBitfield) {
     }
@@ -438,3 +449,259 @@ TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSet
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwTimeStampsTag->getBaseGraphicsAllocation()->getAllocationType());
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwPerfCounterTag->getBaseGraphicsAllocation()->getAllocationType());
 }
+
+TEST_F(TagAllocatorTest, givenMagazineSizeWhenGettingFirstTagThenMagazineIsRefilledWithHalfOfItsSizeInPoolOrder) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 1, deviceBitfield, 8, true);
+    auto firstFreeTag = tagAllocator.getFreeTagsHead();
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(firstFreeTag, node);
+    EXPECT_TRUE(tagAllocator.usedTags.peekContains(*node));
+
+    auto magazine = tagAllocator.getThreadMagazine();
+    ASSERT_NE(nullptr, magazine);
+    EXPECT_EQ(1u, tagAllocator.magazines.size());
+    EXPECT_EQ(3u, magazine->nodes.size());
+
+    size_t freeTagsCount = 0;
+    for (auto freeTag = tagAllocator.getFreeTagsHead(); freeTag != nullptr; freeTag = freeTag->next) {
+        freeTagsCount++;
+    }
+    EXPECT_EQ(12u, freeTagsCount);
+
+    auto nextNode = tagAllocator.getTag();
+    EXPECT_EQ(ptrOffset(node->tagForCpuAccess, sizeof(TimeStamps)), nextNode->tagForCpuAccess);
+
+    tagAllocator.returnTag(node);
+    tagAllocator.returnTag(nextNode);
+}
+
+TEST_F(TagAllocatorTest, givenMagazineWhenReturningReadyTagThenItIsCachedInMagazineAndReusedFirst) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 1, deviceBitfield, 8, true);
+
+    auto node = tagAllocator.getTag();
+    tagAllocator.returnTag(node);
+
+    EXPECT_FALSE(tagAllocator.usedTags.peekContains(*node));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*node));
+    EXPECT_EQ(node, tagAllocator.getThreadMagazine()->nodes.back());
+
+    EXPECT_EQ(node, tagAllocator.getTag());
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenFullMagazineWhenReturningTagThenHalfOfMagazineIsFlushedToFreeTags) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 1, deviceBitfield, 4, true);
+
+    TagNode<TimeStamps> *nodes[6];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    auto magazine = tagAllocator.getThreadMagazine();
+    EXPECT_EQ(0u, magazine->nodes.size());
+
+    for (int i = 0; i < 4; i++) {
+        tagAllocator.returnTag(nodes[i]);
+    }
+    EXPECT_EQ(4u, magazine->nodes.size());
+
+    tagAllocator.returnTag(nodes[4]);
+    EXPECT_EQ(3u, magazine->nodes.size());
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*nodes[0]));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*nodes[1]));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*nodes[4]));
+
+    tagAllocator.returnTag(nodes[5]);
+}
+
+TEST_F(TagAllocatorTest, givenMagazineWhenReturningNotReadyTagThenMoveToDeferredListAndReleaseItOnRefill) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield, 2, true);
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+
+    node1->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*node1));
+    EXPECT_TRUE(tagAllocator.getThreadMagazine()->nodes.empty());
+
+    node1->tagForCpuAccess->release = true;
+    EXPECT_EQ(node1, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+}
+
+TEST_F(TagAllocatorTest, givenUsedTagsTrackingDisabledWhenGettingAndReturningTagThenUsedListIsNotUpdated) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1, deviceBitfield, 0, false);
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(nullptr, tagAllocator.getThreadMagazine());
+
+    tagAllocator.returnTag(node);
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node));
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesUsedFromManyThreadsWhenGettingAndReturningTagsThenEachTagHasSingleOwner) {
+    const size_t threadsCount = 8;
+    const size_t iterations = 2000;
+    const size_t tagsHeldPerThread = 4;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 64, 1, deviceBitfield, 8, false);
+
+    std::mutex ownedTagsMutex;
+    std::unordered_set<TagNode<TimeStamps> *> ownedTags;
+    std::atomic<uint32_t> doubleOwnedTags{0};
+
+    auto worker = [&]() {
+        TagNode<TimeStamps> *heldTags[tagsHeldPerThread] = {};
+        for (size_t i = 0; i < iterations; i++) {
+            auto &slot = heldTags[i % tagsHeldPerThread];
+            if (slot) {
+                {
+                    std::lock_guard<std::mutex> lock(ownedTagsMutex);
+                    ownedTags.erase(slot);
+                }
+                tagAllocator.returnTag(slot);
+            }
+            slot = tagAllocator.getTag();
+            std::lock_guard<std::mutex> lock(ownedTagsMutex);
+            if (!ownedTags.insert(slot).second) {
+                doubleOwnedTags++;
+            }
+        }
+        for (auto tag : heldTags) {
+            {
+                std::lock_guard<std::mutex> lock(ownedTagsMutex);
+                ownedTags.erase(tag);
+            }
+            tagAllocator.returnTag(tag);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, doubleOwnedTags.load());
+    EXPECT_TRUE(ownedTags.empty());
+    EXPECT_LE(tagAllocator.magazines.size(), threadsCount);
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+}
+
+TEST_F(TagAllocatorTest, givenMoreThreadsThanMagazinesWhenGettingTagsThenOverflowThreadsUseFreeTagsWithoutTakingAllocatorLock) {
+    using AllocatorType = MockTagAllocator<TimeStamps>;
+    const size_t magazinesCount = AllocatorType::maxMagazinesCount;
+    const size_t overflowThreadsCount = 8;
+    const size_t threadsCount = magazinesCount + overflowThreadsCount;
+    AllocatorType tagAllocator(memoryManager, 64, 1, deviceBitfield, 4, false);
+
+    std::atomic<size_t> threadsWithMagazineCount{0};
+    std::atomic<size_t> threadsStartedCount{0};
+    std::atomic<size_t> overflowThreadsDoneCount{0};
+    std::atomic<bool> allocatorLocked{false};
+    std::atomic<bool> allocatorUnlocked{false};
+    std::atomic<uint32_t> overflowThreadsWithMagazineCount{0};
+
+    auto worker = [&]() {
+        auto magazine = tagAllocator.getThreadMagazine();
+        if (magazine) {
+            threadsWithMagazineCount++;
+        }
+        threadsStartedCount++;
+        if (magazine) {
+            while (!allocatorUnlocked) {
+                std::this_thread::yield();
+            }
+        } else {
+            while (!allocatorLocked) {
+                std::this_thread::yield();
+            }
+            if (tagAllocator.getThreadMagazine()) {
+                overflowThreadsWithMagazineCount++;
+            }
+            auto node = tagAllocator.getTag();
+            tagAllocator.returnTag(node);
+            overflowThreadsDoneCount++;
+        }
+        auto node = tagAllocator.getTag();
+        tagAllocator.returnTag(node);
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(worker);
+    }
+    while (threadsStartedCount < threadsCount) {
+        std::this_thread::yield();
+    }
+
+    bool overflowThreadsFinishedUnderLock = false;
+    {
+        std::unique_lock<std::mutex> lock(tagAllocator.allocatorMutex);
+        allocatorLocked = true;
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (overflowThreadsDoneCount < overflowThreadsCount && std::chrono::steady_clock::now() < timeout) {
+            std::this_thread::yield();
+        }
+        overflowThreadsFinishedUnderLock = (overflowThreadsDoneCount == overflowThreadsCount);
+    }
+    allocatorUnlocked = true;
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(magazinesCount, threadsWithMagazineCount.load());
+    EXPECT_EQ(magazinesCount, tagAllocator.magazines.size());
+    EXPECT_EQ(0u, overflowThreadsWithMagazineCount.load());
+    EXPECT_TRUE(overflowThreadsFinishedUnderLock);
+}
+
+TEST_F(TagAllocatorTest, DISABLED_profilingGetAndReturnTagFromManyThreadsWithAndWithoutMagazines) {
+    const size_t threadsCount = 8;
+    const size_t iterations = 200000;
+    const size_t tagsHeldPerThread = 8;
+
+    auto runStress = [&](MockTagAllocator<TimeStamps> &tagAllocator) {
+        auto worker = [&]() {
+            TagNode<TimeStamps> *heldTags[tagsHeldPerThread] = {};
+            for (size_t i = 0; i < iterations; i++) {
+                auto &slot = heldTags[i % tagsHeldPerThread];
+                if (slot) {
+                    tagAllocator.returnTag(slot);
+                }
+                slot = tagAllocator.getTag();
+            }
+            for (auto tag : heldTags) {
+                tagAllocator.returnTag(tag);
+            }
+        };
+
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back(worker);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    MockTagAllocator<TimeStamps> sharedListAllocator(memoryManager, 2048, 64, deviceBitfield, 0, true);
+    auto sharedListTime = runStress(sharedListAllocator);
+
+    MockTagAllocator<TimeStamps> magazineAllocator(memoryManager, 2048, 64, deviceBitfield, 32, false);
+    auto magazineTime = runStress(magazineAllocator);
+
+    std::cout << "threads: " << threadsCount << ", get/return pairs per thread: " << iterations << std::endl
+              << "shared free list + used list: " << sharedListTime << " us" << std::endl
+              << "per-thread magazines:         " << magazineTime << " us" << std::endl;
+}
@@ -25,10 +25,8 @@ CommandContainer::~CommandContainer() {
         return;
     }
 
-    auto memoryManager = device->getMemoryManager();
-
     for (auto *alloc : cmdBufferAllocations) {
-        memoryManager->freeGraphicsMemory(alloc);
+        heapHelper->storeCommandBufferAllocation(alloc);
     }
 
     for (auto allocationIndirectHeap : allocationIndirectHeaps) {
@@ -39,6 +37,7 @@ CommandContainer::~CommandContainer() {
             getHeapHelper()->storeHeapAllocation(deallocation);
         }
     }
+    heapHelper->trimStorageForReuse();
 }
 
 ErrorCode CommandContainer::initialize(Device *device) {
@@ -51,15 +50,7 @@ ErrorCode CommandContainer::initialize(Device *device) {
     heapHelper = std::unique_ptr<HeapHelper>(new HeapHelper(device->getMemoryManager(), device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage(), device->getNumAvailableDevices() > 1u));
 
     size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
-    AllocationProperties properties{device->getRootDeviceIndex(),
-                                    true /* allocateMemory*/,
-                                    alignedSize,
-                                    GraphicsAllocation::AllocationType::COMMAND_BUFFER,
-                                    (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
-                                    false,
-                                    device->getDeviceBitfield()};
-
-    auto cmdBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    auto cmdBufferAllocation = heapHelper->getCommandBufferAllocation(alignedSize, device->getRootDeviceIndex());
     if (!cmdBufferAllocation) {
         return ErrorCode::OUT_OF_DEVICE_MEMORY;
     }
@@ -114,16 +105,25 @@ void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
     getResidencyContainer().clear();
+    for (auto deallocation : deallocationContainer) {
+        if (((deallocation->getAllocationType() == GraphicsAllocation::AllocationType::INTERNAL_HEAP) || (deallocation->getAllocationType() == GraphicsAllocation::AllocationType::LINEAR_STREAM))) {
+            getHeapHelper()->storeHeapAllocation(deallocation);
+        }
+    }
     getDeallocationContainer().clear();
 
     for (size_t i = 1; i < cmdBufferAllocations.size(); i++) {
-        device->getMemoryManager()->freeGraphicsMemory(cmdBufferAllocations[i]);
+        getHeapHelper()->storeCommandBufferAllocation(cmdBufferAllocations[i]);
     }
     cmdBufferAllocations.erase(cmdBufferAllocations.begin() + 1, cmdBufferAllocations.end());
+    getHeapHelper()->trimStorageForReuse();
 
     commandStream->replaceBuffer(cmdBufferAllocations[0]->getUnderlyingBuffer(),
                                  defaultListCmdBufferSize);
+    commandStream->replaceGraphicsAllocation(cmdBufferAllocations[0]);
     addToResidencyContainer(commandStream->getGraphicsAllocation());
+    submissionStartCmdBufferIndex = 0u;
+    submissionStartOffset = 0u;
 
     for (auto &indirectHeap : indirectHeaps) {
         indirectHeap->replaceBuffer(indirectHeap->getCpuBase(),
@@ -134,6 +134,20 @@ void CommandContainer::reset() {
     reserveBindlessOffsets(*indirectHeaps[HeapType::SURFACE_STATE]);
 }
 
+void CommandContainer::continueAfterSubmission() {
+    setDirtyStateForAllHeaps(true);
+    slmSize = std::numeric_limits<uint32_t>::max();
+    getResidencyContainer().clear();
+
+    addToResidencyContainer(commandStream->getGraphicsAllocation());
+    for (auto &indirectHeap : indirectHeaps) {
+        addToResidencyContainer(indirectHeap->getGraphicsAllocation());
+    }
+
+    submissionStartCmdBufferIndex = cmdBufferAllocations.size() - 1;
+    submissionStartOffset = commandStream->getUsed();
+}
+
 void *CommandContainer::getHeapSpaceAllowGrow(HeapType heapType,
                                               size_t size) {
     auto indirectHeap = getIndirectHeap(heapType);
@@ -195,15 +209,7 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
 
 void CommandContainer::allocateNextCommandBuffer() {
     size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
-    AllocationProperties properties{0u,
-                                    true /* allocateMemory*/,
-                                    alignedSize,
-                                    GraphicsAllocation::AllocationType::COMMAND_BUFFER,
-                                    (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
-                                    false,
-                                    device->getDeviceBitfield()};
-
-    auto cmdBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    auto cmdBufferAllocation = getHeapHelper()->getCommandBufferAllocation(alignedSize, device->getRootDeviceIndex());
     UNRECOVERABLE_IF(!cmdBufferAllocation);
 
     cmdBufferAllocations.push_back(cmdBufferAllocation);
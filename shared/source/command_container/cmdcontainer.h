@@ -90,6 +90,10 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void allocateNextCommandBuffer();
 
     void reset();
+    void continueAfterSubmission();
+
+    size_t getSubmissionStartCmdBufferIndex() const { return submissionStartCmdBufferIndex; }
+    size_t getSubmissionStartOffset() const { return submissionStartOffset; }
 
     bool isHeapDirty(HeapType heapType) const { return (dirtyHeaps & (1u << heapType)); }
     bool isAnyHeapDirty() const { return dirtyHeaps != 0; }
@@ -110,6 +114,8 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint64_t instructionHeapBaseAddress = 0u;
     uint32_t dirtyHeaps = std::numeric_limits<uint32_t>::max();
     uint32_t numIddsPerBlock = 64;
+    size_t submissionStartCmdBufferIndex = 0u;
+    size_t submissionStartOffset = 0u;
 
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<IndirectHeap> indirectHeaps[HeapType::NUM_TYPES];
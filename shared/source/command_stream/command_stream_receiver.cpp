@@ -26,6 +26,7 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/wait_policy.h"
 
 namespace NEO {
 
@@ -46,6 +47,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         indirectHeap[i] = nullptr;
     }
     internalAllocationStorage = std::make_unique<InternalAllocationStorage>(*this);
+    waitPolicy = std::make_unique<WaitPolicy>();
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
@@ -212,10 +214,7 @@ void CommandStreamReceiver::cleanupResources() {
     }
 }
 
-bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) {
-    std::chrono::high_resolution_clock::time_point time1, time2;
-    int64_t timeDiff = 0;
-
+bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait, FlushStamp flushStampToWait) {
     uint32_t latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
         if (!this->flushBatchedSubmissions()) {
@@ -223,20 +222,11 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
         }
     }
 
-    time1 = std::chrono::high_resolution_clock::now();
-    while (*getTagAddress() < taskCountToWait && timeDiff <= timeoutMicroseconds) {
-        std::this_thread::yield();
-        CpuIntrinsics::pause();
-
-        if (enableTimeout) {
-            time2 = std::chrono::high_resolution_clock::now();
-            timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
-        }
-    }
-    if (*getTagAddress() >= taskCountToWait) {
-        return true;
+    auto isCompleted = [&]() { return *getTagAddress() >= taskCountToWait; };
+    if (flushStampToWait == 0) {
+        return waitPolicy->wait(isCompleted, enableTimeout, timeoutMicroseconds);
     }
-    return false;
+    return waitPolicy->wait(isCompleted, [&]() { waitForFlushStamp(flushStampToWait); }, enableTimeout, timeoutMicroseconds);
 }
 
 void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
@@ -499,7 +489,8 @@ bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surfa
 TagAllocator<HwTimeStamps> *CommandStreamReceiver::getEventTsAllocator() {
     if (profilingTimeStampAllocator.get() == nullptr) {
         profilingTimeStampAllocator = std::make_unique<TagAllocator<HwTimeStamps>>(
-            rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize, sizeof(HwTimeStamps), false, osContext->getDeviceBitfield());
+            rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize, sizeof(HwTimeStamps), false, osContext->getDeviceBitfield(),
+            getPreferredTagMagazineSize(), false);
     }
     return profilingTimeStampAllocator.get();
 }
@@ -507,7 +498,8 @@ TagAllocator<HwTimeStamps> *CommandStreamReceiver::getEventTsAllocator() {
 TagAllocator<HwPerfCounter> *CommandStreamReceiver::getEventPerfCountAllocator(const uint32_t tagSize) {
     if (perfCounterAllocator.get() == nullptr) {
         perfCounterAllocator = std::make_unique<TagAllocator<HwPerfCounter>>(
-            rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize, tagSize, false, osContext->getDeviceBitfield());
+            rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize, tagSize, false, osContext->getDeviceBitfield(),
+            getPreferredTagMagazineSize(), false);
     }
     return perfCounterAllocator.get();
 }
@@ -520,7 +512,8 @@ TagAllocator<TimestampPacketStorage> *CommandStreamReceiver::getTimestampPacketA
 
         timestampPacketAllocator = std::make_unique<TagAllocator<TimestampPacketStorage>>(
             rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize * 4,
-            sizeof(TimestampPacketStorage), doNotReleaseNodes, osContext->getDeviceBitfield());
+            sizeof(TimestampPacketStorage), doNotReleaseNodes, osContext->getDeviceBitfield(),
+            getPreferredTagMagazineSize(), false);
     }
     return timestampPacketAllocator.get();
 }
@@ -533,6 +526,17 @@ size_t CommandStreamReceiver::getPreferredTagPoolSize() const {
     return 2048;
 }
 
+size_t CommandStreamReceiver::getPreferredTagMagazineSize() const {
+    if (DebugManager.flags.TagAllocatorMagazineSize.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.TagAllocatorMagazineSize.get());
+    }
+    if (DebugManager.flags.DisableTimestampPacketOptimizations.get()) {
+        return 0;
+    }
+
+    return 32;
+}
+
 bool CommandStreamReceiver::expectMemory(const void *gfxAddress, const void *srcAddress,
                                          size_t length, uint32_t compareOperation) {
     auto isMemoryEqual = (memcmp(gfxAddress, srcAddress, length) == 0);
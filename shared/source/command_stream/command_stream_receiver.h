@@ -44,6 +44,7 @@ struct TimestampPacketStorage;
 
 template <typename T1>
 class TagAllocator;
+class WaitPolicy;
 
 enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
@@ -105,6 +106,7 @@ class CommandStreamReceiver {
         return tagAllocation;
     }
     MOCKABLE_VIRTUAL volatile uint32_t *getTagAddress() const { return tagAddress; }
+    WaitPolicy &getWaitPolicy() const { return *waitPolicy; }
     uint64_t getDebugPauseStateGPUAddress() const { return tagAllocation->getGpuAddress() + debugPauseStateAddressOffset; }
 
     virtual bool waitForFlushStamp(FlushStamp &flushStampToWait) { return true; };
@@ -135,8 +137,11 @@ class CommandStreamReceiver {
     bool isStallingPipeControlOnNextFlushRequired() const { return stallingPipeControlOnNextFlushRequired; }
 
     virtual void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) = 0;
-    virtual bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait);
+    // flushStampToWait is the stamp of the submission that covers taskCountToWait, 0 if unknown (wait never blocks in OS then)
+    virtual bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait, FlushStamp flushStampToWait);
     virtual void downloadAllocations(){};
+    // called before the allocation is freed and its GPU VA released
+    virtual void invalidateAllocationPages(GraphicsAllocation &gfxAllocation){};
 
     void setSamplerCacheFlushRequired(SamplerCacheFlushState value) { this->samplerCacheFlushRequired = value; }
 
@@ -170,6 +175,7 @@ class CommandStreamReceiver {
     InternalAllocationStorage *getInternalAllocationStorage() const { return internalAllocationStorage.get(); }
     MOCKABLE_VIRTUAL bool createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush);
     virtual size_t getPreferredTagPoolSize() const;
+    size_t getPreferredTagMagazineSize() const;
     virtual void setupContext(OsContext &osContext) { this->osContext = &osContext; }
     OsContext &getOsContext() const { return *osContext; }
 
@@ -226,6 +232,7 @@ class CommandStreamReceiver {
     std::unique_ptr<ExperimentalCommandBuffer> experimentalCmdBuffer;
     std::unique_ptr<InternalAllocationStorage> internalAllocationStorage;
     std::unique_ptr<KmdNotifyHelper> kmdNotifyHelper;
+    std::unique_ptr<WaitPolicy> waitPolicy;
     std::unique_ptr<ScratchSpaceController> scratchSpaceController;
     std::unique_ptr<TagAllocator<HwTimeStamps>> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocator<HwPerfCounter>> perfCounterAllocator;
@@ -786,11 +786,11 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
                      "\nWaiting for task count %u at location %p. Current value: %u\n",
                      taskCountToWait, getTagAddress(), *getTagAddress());
 
-    auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
+    auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait, flushStampToWait);
     if (!status) {
         waitForFlushStamp(flushStampToWait);
         //now call blocking wait, this is to ensure that task count is reached
-        waitForCompletionWithTimeout(false, 0, taskCountToWait);
+        waitForCompletionWithTimeout(false, 0, taskCountToWait, flushStampToWait);
     }
     UNRECOVERABLE_IF(*getTagAddress() < taskCountToWait);
 
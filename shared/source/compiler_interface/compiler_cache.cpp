@@ -11,22 +11,47 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/directory.h"
+#include "shared/source/utilities/file_time.h"
+#include "shared/source/utilities/mapped_file.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <ctime>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+std::atomic<uint32_t> CompilerCache::tempFileCounter{0u};
+constexpr time_t CompilerCache::modificationTimeRefreshIntervalSeconds;
+constexpr time_t CompilerCache::staleTempFileAgeSeconds;
+
+namespace {
+constexpr const char *tempFileExtension = ".tmp";
+
+bool hasSuffix(const std::string &name, size_t nameStart, const std::string &suffix) {
+    return (name.size() >= nameStart + suffix.size()) &&
+           (0 == name.compare(name.size() - suffix.size(), suffix.size(), suffix));
+}
+} // namespace
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> additionalData) {
+    FastHash hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -34,6 +59,11 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(&*options.begin(), options.size());
     hash.update("----", 4);
     hash.update(&*internalOptions.begin(), internalOptions.size());
+    if (false == additionalData.empty()) {
+        // kept out of the key when empty, so entries cached without additional data stay valid
+        hash.update("----", 4);
+        hash.update(additionalData.begin(), additionalData.size());
+    }
 
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
@@ -54,20 +84,241 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+std::string CompilerCache::getFilePath(const std::string &kernelFileHash) const {
+    return config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+
+    storeInMemory(kernelFileHash, pBinary, binarySize);
+
+    std::string filePath = getFilePath(kernelFileHash);
+
+    // write to a unique temporary file and publish it with rename, so that concurrent
+    // readers and writers of the same entry never observe a partially written binary
+    std::stringstream tempFilePath;
+    tempFilePath << filePath << "."
+                 << std::hex << std::hash<std::thread::id>{}(std::this_thread::get_id())
+                 << std::chrono::steady_clock::now().time_since_epoch().count()
+                 << tempFileCounter++ << tempFileExtension;
+    std::string tempFile = tempFilePath.str();
+
+    if (binarySize != writeDataToFile(tempFile.c_str(), pBinary, binarySize)) {
+        std::remove(tempFile.c_str());
+        return false;
+    }
+    if (0 != std::rename(tempFile.c_str(), filePath.c_str())) {
+        std::remove(tempFile.c_str());
+        if (false == fileExists(filePath)) {
+            return false;
+        }
+    }
+
+    if (config.cacheSize == 0u) {
+        return true;
+    }
+
+    std::vector<std::string> evictedEntries;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        initializeDiskIndex();
+        trackDiskEntry(kernelFileHash, binarySize, time(nullptr));
+
+        while (diskUsage > config.cacheSize && diskLru.size() > 1u) {
+            auto &oldest = diskLru.front();
+            auto it = diskIndex.find(oldest);
+            diskUsage -= it->second.size;
+            evictedEntries.push_back(oldest);
+            diskIndex.erase(it);
+            diskLru.pop_front();
+        }
+    }
+
+    for (auto &evicted : evictedEntries) {
+        std::remove(getFilePath(evicted).c_str());
+    }
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    auto binary = loadFromMemory(kernelFileHash, cachedBinarySize);
+    bool readFromDisk = (binary == nullptr);
+    if (readFromDisk) {
+        std::string filePath = getFilePath(kernelFileHash);
+        binary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+        if (binary == nullptr) {
+            return nullptr;
+        }
+        storeInMemory(kernelFileHash, binary.get(), cachedBinarySize);
+    }
+
+    if (config.cacheSize != 0u) {
+        touchDiskEntry(kernelFileHash, readFromDisk);
+    }
+    return binary;
+}
+
+std::unique_ptr<MappedFile> CompilerCache::mapCachedBinary(const std::string kernelFileHash) {
+    if (false == config.mapCachedBinaries) {
+        return nullptr;
+    }
+
+    auto mappedBinary = MappedFile::openReadOnly(getFilePath(kernelFileHash));
+    if (mappedBinary && (config.cacheSize != 0u)) {
+        touchDiskEntry(kernelFileHash, true);
+    }
+    return mappedBinary;
+}
+
+void CompilerCache::initializeDiskIndex() {
+    if (diskIndexInitialized) {
+        return;
+    }
+    diskIndexInitialized = true;
+
+    struct FileInfo {
+        std::string hash;
+        size_t size;
+        time_t lastModified;
+    };
+    std::vector<FileInfo> files;
+
+    auto &extension = config.cacheFileExtension;
+    auto now = time(nullptr);
+    for (auto &file : Directory::getFiles(config.cacheDir)) {
+        auto nameStart = file.find_last_of("/\\");
+        nameStart = (nameStart == std::string::npos) ? 0u : nameStart + 1;
+
+        struct stat fileStat = {};
+        if (false == hasSuffix(file, nameStart, extension)) {
+            // temporary files of writers that crashed before rename are never published,
+            // remove old ones and skip recent ones which may still be written by other processes
+            if (hasSuffix(file, nameStart, tempFileExtension) &&
+                (std::string::npos != file.find(extension + ".", nameStart)) &&
+                (0 == stat(file.c_str(), &fileStat)) &&
+                (now - fileStat.st_mtime >= staleTempFileAgeSeconds)) {
+                std::remove(file.c_str());
+            }
+            continue;
+        }
+
+        if (0 != stat(file.c_str(), &fileStat)) {
+            continue;
+        }
+        files.push_back({file.substr(nameStart, file.size() - nameStart - extension.size()),
+                         static_cast<size_t>(fileStat.st_size),
+                         fileStat.st_mtime});
+    }
+
+    std::sort(files.begin(), files.end(), [](const FileInfo &lhs, const FileInfo &rhs) {
+        return lhs.lastModified < rhs.lastModified;
+    });
+    for (auto &file : files) {
+        trackDiskEntry(file.hash, file.size, file.lastModified);
+    }
+}
+
+void CompilerCache::trackDiskEntry(const std::string &kernelFileHash, size_t size, time_t lastModified) {
+    auto it = diskIndex.find(kernelFileHash);
+    if (it != diskIndex.end()) {
+        diskUsage -= it->second.size;
+        diskLru.erase(it->second.lruPosition);
+        diskIndex.erase(it);
+    }
+
+    DiskEntry entry;
+    entry.size = size;
+    entry.lastModified = lastModified;
+    entry.lruPosition = diskLru.insert(diskLru.end(), kernelFileHash);
+    diskIndex.emplace(kernelFileHash, entry);
+    diskUsage += size;
+}
+
+void CompilerCache::touchDiskEntry(const std::string &kernelFileHash, bool readFromDisk) {
+    bool refreshModificationTime = readFromDisk;
+    auto now = refreshModificationTime ? time(nullptr) : 0;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        initializeDiskIndex();
+        auto it = diskIndex.find(kernelFileHash);
+        if (it != diskIndex.end()) {
+            diskLru.splice(diskLru.end(), diskLru, it->second.lruPosition);
+            if (refreshModificationTime) {
+                refreshModificationTime = (now - it->second.lastModified >= modificationTimeRefreshIntervalSeconds);
+                if (refreshModificationTime) {
+                    it->second.lastModified = now;
+                }
+            }
+        }
+    }
+
+    // other processes and later runs seed their LRU order from modification times,
+    // memory tier hits and entries refreshed recently don't need another file system call
+    if (refreshModificationTime) {
+        setFileModificationTime(getFilePath(kernelFileHash), now);
+    }
+}
+
+void CompilerCache::storeInMemory(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (binarySize > config.inMemoryCacheSize) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        auto it = memoryIndex.find(kernelFileHash);
+        if (it != memoryIndex.end()) {
+            memoryLru.splice(memoryLru.end(), memoryLru, it->second.lruPosition);
+            return;
+        }
+    }
+
+    std::shared_ptr<const char> binary(new char[binarySize], std::default_delete<char[]>());
+    memcpy_s(const_cast<char *>(binary.get()), binarySize, pBinary, binarySize);
+
+    std::lock_guard<std::mutex> lock(indexMtx);
+    if (memoryIndex.find(kernelFileHash) != memoryIndex.end()) {
+        return;
+    }
+
+    while (memoryUsage + binarySize > config.inMemoryCacheSize) {
+        auto it = memoryIndex.find(memoryLru.front());
+        memoryUsage -= it->second.size;
+        memoryIndex.erase(it);
+        memoryLru.pop_front();
+    }
+
+    MemoryEntry entry;
+    entry.binary = std::move(binary);
+    entry.size = binarySize;
+    entry.lruPosition = memoryLru.insert(memoryLru.end(), kernelFileHash);
+    memoryIndex.emplace(kernelFileHash, std::move(entry));
+    memoryUsage += binarySize;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadFromMemory(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::shared_ptr<const char> binary;
+    size_t binarySize = 0u;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        auto it = memoryIndex.find(kernelFileHash);
+        if (it == memoryIndex.end()) {
+            return nullptr;
+        }
+        memoryLru.splice(memoryLru.end(), memoryLru, it->second.lruPosition);
+        binary = it->second.binary;
+        binarySize = it->second.size;
+    }
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    // keep the same layout as loadDataFromFile - zero-terminated copy
+    std::unique_ptr<char[]> ret(new char[binarySize + 1]);
+    memcpy_s(ret.get(), binarySize, binary.get(), binarySize);
+    ret[binarySize] = 0;
+    cachedBinarySize = binarySize;
+    return ret;
 }
 
 } // namespace NEO
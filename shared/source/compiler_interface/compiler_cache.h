@@ -9,25 +9,34 @@
 
 #include "shared/source/utilities/arrayref.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <ctime>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 struct HardwareInfo;
+class MappedFile;
 
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u;         // disk budget in bytes, 0 - unlimited
+    size_t inMemoryCacheSize = 0u; // in-memory tier budget in bytes, 0 - disabled
+    bool mapCachedBinaries = false;
 };
 
 class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
-                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               ArrayRef<const char> additionalData = {});
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
@@ -39,9 +48,45 @@ class CompilerCache {
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+    MOCKABLE_VIRTUAL std::unique_ptr<MappedFile> mapCachedBinary(const std::string kernelFileHash);
+
+    // modification time of a cached file is refreshed on disk hits at most this often
+    static constexpr time_t modificationTimeRefreshIntervalSeconds = 60;
+    // temporary files not published for this long were left by a crashed writer
+    static constexpr time_t staleTempFileAgeSeconds = 600;
 
   protected:
-    static std::mutex cacheAccessMtx;
+    struct DiskEntry {
+        size_t size = 0u;
+        time_t lastModified = 0;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    struct MemoryEntry {
+        std::shared_ptr<const char> binary;
+        size_t size = 0u;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::string getFilePath(const std::string &kernelFileHash) const;
+    void initializeDiskIndex();
+    void trackDiskEntry(const std::string &kernelFileHash, size_t size, time_t lastModified);
+    void touchDiskEntry(const std::string &kernelFileHash, bool readFromDisk);
+    void storeInMemory(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> loadFromMemory(const std::string &kernelFileHash, size_t &cachedBinarySize);
+
     CompilerCacheConfig config;
+
+    std::mutex indexMtx;
+    bool diskIndexInitialized = false;
+    size_t diskUsage = 0u;
+    std::list<std::string> diskLru;
+    std::unordered_map<std::string, DiskEntry> diskIndex;
+
+    size_t memoryUsage = 0u;
+    std::list<std::string> memoryLru;
+    std::unordered_map<std::string, MemoryEntry> memoryIndex;
+
+    static std::atomic<uint32_t> tempFileCounter;
 };
 } // namespace NEO
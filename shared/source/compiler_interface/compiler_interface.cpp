@@ -11,6 +11,8 @@
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/hw_info.h"
 
 #include "opencl/source/os_interface/os_inc_base.h"
@@ -25,7 +27,9 @@
 #undef IGC_CLEANUP
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 namespace NEO {
 SpinLock CompilerInterface::spinlock;
@@ -36,11 +40,82 @@ enum CachingMode {
     PreProcess
 };
 
+namespace {
+constexpr ConstStringRef includeDirective = "#include";
+
+bool containsInclude(ArrayRef<const char> text) {
+    return std::search(text.begin(), text.end(), includeDirective.begin(), includeDirective.end()) != text.end();
+}
+
+// all includes of OpenCL sources packed with their headers into ELF (clCompileProgram) must refer to embedded headers,
+// otherwise output depends on files that are not part of the cache key
+bool areIncludesEmbedded(ArrayRef<const char> src) {
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(ArrayRef<const uint8_t>::fromAny(src.begin(), src.size()), decodeErrors, decodeWarnings);
+    if ((elf.elfFileHeader == nullptr) || (elf.elfFileHeader->shStrNdx >= elf.sectionHeaders.size())) {
+        return false;
+    }
+    auto sectionNames = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+
+    std::vector<ConstStringRef> headerNames;
+    std::vector<ArrayRef<const char>> sources;
+    for (auto &section : elf.sectionHeaders) {
+        if ((section.header->type != Elf::SHT_OPENCL_SOURCE) && (section.header->type != Elf::SHT_OPENCL_HEADER)) {
+            continue;
+        }
+        sources.push_back(ArrayRef<const char>::fromAny(section.data.begin(), section.data.size()));
+        if ((section.header->type == Elf::SHT_OPENCL_HEADER) && (section.header->name < sectionNames.size())) {
+            headerNames.push_back(ConstStringRef(reinterpret_cast<const char *>(sectionNames.begin()) + section.header->name));
+        }
+    }
+
+    for (auto &source : sources) {
+        auto it = source.begin();
+        while ((it = std::search(it, source.end(), includeDirective.begin(), includeDirective.end())) != source.end()) {
+            it += includeDirective.size();
+            while ((it != source.end()) && ((*it == ' ') || (*it == '\t'))) {
+                it++;
+            }
+            if ((it == source.end()) || ((*it != '"') && (*it != '<'))) {
+                return false;
+            }
+            auto closingChar = (*it == '"') ? '"' : '>';
+            auto nameBegin = ++it;
+            it = std::find(nameBegin, source.end(), closingChar);
+            if (it == source.end()) {
+                return false;
+            }
+            ConstStringRef includeName(nameBegin, static_cast<size_t>(it - nameBegin));
+            if (std::find(headerNames.begin(), headerNames.end(), includeName) == headerNames.end()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
 CompilerInterface::CompilerInterface()
     : cache() {
 }
 CompilerInterface::~CompilerInterface() = default;
 
+std::vector<char> CompilerInterface::serializeSpecConstants(const specConstValuesMap &specConstants) {
+    std::vector<std::pair<uint32_t, uint64_t>> sortedSpecConstants(specConstants.begin(), specConstants.end());
+    std::sort(sortedSpecConstants.begin(), sortedSpecConstants.end());
+
+    std::vector<char> serialized;
+    serialized.reserve(sortedSpecConstants.size() * (sizeof(uint32_t) + sizeof(uint64_t)));
+    for (const auto &specConst : sortedSpecConstants) {
+        auto id = reinterpret_cast<const char *>(&specConst.first);
+        auto value = reinterpret_cast<const char *>(&specConst.second);
+        serialized.insert(serialized.end(), id, id + sizeof(specConst.first));
+        serialized.insert(serialized.end(), value, value + sizeof(specConst.second));
+    }
+    return serialized;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::build(
     const NEO::Device &device,
     const TranslationInput &input,
@@ -67,13 +142,17 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     std::string kernelFileHash;
+    std::vector<char> specConstants;
+    if (cachingMode != CachingMode::None) {
+        specConstants = serializeSpecConstants(input.specializedValues);
+    }
     if (cachingMode == CachingMode::Direct) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(specConstants));
+        if (loadFromCache(kernelFileHash, input, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -124,9 +203,9 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(specConstants));
+        if (loadFromCache(kernelFileHash, input, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -156,6 +235,46 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     return TranslationOutput::ErrorCode::Success;
 }
 
+bool CompilerInterface::loadFromCache(const std::string &kernelFileHash, const TranslationInput &input, TranslationOutput &output) {
+    if (input.allowMappedCachedBinary) {
+        output.mappedDeviceBinary = cache->mapCachedBinary(kernelFileHash);
+        if (output.mappedDeviceBinary) {
+            return true;
+        }
+    }
+    output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+    return nullptr != output.deviceBinary.mem;
+}
+
+bool CompilerInterface::isStageCachingAllowed(const TranslationInput &input) {
+    if ((false == input.allowCaching) || (nullptr != input.GTPinInput)) {
+        return false;
+    }
+    if (input.srcType == IGC::CodeType::oclC) {
+        return false == containsInclude(input.src);
+    }
+    if (input.srcType == IGC::CodeType::elf) {
+        return areIncludesEmbedded(input.src);
+    }
+    return true;
+}
+
+std::string CompilerInterface::getStageCacheKey(const NEO::Device &device, ConstStringRef stage, IGC::CodeType::CodeType_t outType, const TranslationInput &input) {
+    std::vector<char> additionalData(stage.begin(), stage.end());
+    auto outTypeData = reinterpret_cast<const char *>(&outType);
+    additionalData.insert(additionalData.end(), outTypeData, outTypeData + sizeof(outType));
+    auto specConstants = serializeSpecConstants(input.specializedValues);
+    additionalData.insert(additionalData.end(), specConstants.begin(), specConstants.end());
+
+    return CompilerCache::getCachedFileName(device.getHardwareInfo(), input.src, input.apiOptions, input.internalOptions,
+                                            ArrayRef<const char>(additionalData));
+}
+
+bool CompilerInterface::loadStageOutputFromCache(const std::string &cacheKey, TranslationOutput::MemAndSize &output) {
+    output.mem = cache->loadCachedBinary(cacheKey, output.size);
+    return nullptr != output.mem;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::compile(
     const NEO::Device &device,
     const TranslationInput &input,
@@ -175,6 +294,16 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         outType = getPreferredIntermediateRepresentation(device);
     }
 
+    std::string cacheKey;
+    bool cachingAllowed = isStageCachingAllowed(input);
+    if (cachingAllowed) {
+        cacheKey = getStageCacheKey(device, "compile", outType, input);
+        if (loadStageOutputFromCache(cacheKey, output.intermediateRepresentation)) {
+            output.intermediateCodeType = outType;
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.src.begin(), input.src.size());
     auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -194,6 +323,10 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         return TranslationOutput::ErrorCode::CompilationFailure;
     }
 
+    if (cachingAllowed) {
+        cache->cacheBinary(cacheKey, fclOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(fclOutput->GetOutput()->GetSize<char>()));
+    }
+
     output.intermediateCodeType = outType;
     TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
 
@@ -208,6 +341,15 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    std::string cacheKey;
+    bool cachingAllowed = isStageCachingAllowed(input);
+    if (cachingAllowed) {
+        cacheKey = getStageCacheKey(device, "link", IGC::CodeType::oclGenBin, input);
+        if (loadStageOutputFromCache(cacheKey, output.deviceBinary)) {
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -246,14 +388,35 @@ TranslationOutput::ErrorCode CompilerInterface::link(
     TranslationOutput::makeCopy(output.deviceBinary, currOut->GetOutput());
     TranslationOutput::makeCopy(output.debugData, currOut->GetDebugData());
 
+    // debug data is not cached, binaries that come with it are always linked again
+    if (cachingAllowed && (nullptr == output.debugData.mem)) {
+        cache->cacheBinary(cacheKey, output.deviceBinary.mem.get(), static_cast<uint32_t>(output.deviceBinary.size));
+    }
+
     return TranslationOutput::ErrorCode::Success;
 }
 
-TranslationOutput::ErrorCode CompilerInterface::getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output) {
+TranslationOutput::ErrorCode CompilerInterface::getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output,
+                                                                     bool allowCaching) {
     if (false == isIgcAvailable()) {
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    TranslationInput cacheInput = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    cacheInput.src = srcSpirV;
+    cacheInput.allowCaching = allowCaching;
+    std::string cacheKey;
+    if (allowCaching) {
+        // cached entry holds ids followed by sizes, both arrays have the same number of uint32_t elements
+        cacheKey = getStageCacheKey(device, "specConstantsInfo", IGC::CodeType::oclGenBin, cacheInput);
+        TranslationOutput::MemAndSize cached;
+        if (loadStageOutputFromCache(cacheKey, cached) && (cached.size > 0) && (cached.size % (2 * sizeof(uint32_t)) == 0)) {
+            output.idsBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), cached.mem.get(), cached.size / 2);
+            output.sizesBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), cached.mem.get() + cached.size / 2, cached.size / 2);
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto igcTranslationCtx = createIgcTranslationCtx(device, IGC::CodeType::spirV, IGC::CodeType::oclGenBin);
 
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), srcSpirV.begin(), srcSpirV.size());
@@ -266,6 +429,13 @@ TranslationOutput::ErrorCode CompilerInterface::getSpecConstantsInfo(const NEO::
         return TranslationOutput::ErrorCode::UnknownError;
     }
 
+    auto idsSize = output.idsBuffer->GetSizeRaw();
+    if (allowCaching && (idsSize > 0) && (idsSize == output.sizesBuffer->GetSizeRaw())) {
+        std::vector<char> specConstantsInfo(output.idsBuffer->GetMemory<char>(), output.idsBuffer->GetMemory<char>() + idsSize);
+        specConstantsInfo.insert(specConstantsInfo.end(), output.sizesBuffer->GetMemory<char>(), output.sizesBuffer->GetMemory<char>() + idsSize);
+        cache->cacheBinary(cacheKey, specConstantsInfo.data(), static_cast<uint32_t>(specConstantsInfo.size()));
+    }
+
     return TranslationOutput::ErrorCode::Success;
 }
 
@@ -277,11 +447,22 @@ TranslationOutput::ErrorCode CompilerInterface::createLibrary(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto intermediateRepresentation = IGC::CodeType::llvmBc;
+
+    std::string cacheKey;
+    bool cachingAllowed = isStageCachingAllowed(input);
+    if (cachingAllowed) {
+        cacheKey = getStageCacheKey(device, "createLibrary", intermediateRepresentation, input);
+        if (loadStageOutputFromCache(cacheKey, output.intermediateRepresentation)) {
+            output.intermediateCodeType = intermediateRepresentation;
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
 
-    auto intermediateRepresentation = IGC::CodeType::llvmBc;
     auto igcTranslationCtx = createIgcTranslationCtx(device, IGC::CodeType::elf, intermediateRepresentation);
 
     auto igcOutput = translate(igcTranslationCtx.get(), igcSrc.get(),
@@ -297,6 +478,10 @@ TranslationOutput::ErrorCode CompilerInterface::createLibrary(
         return TranslationOutput::ErrorCode::LinkFailure;
     }
 
+    if (cachingAllowed) {
+        cache->cacheBinary(cacheKey, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+    }
+
     output.intermediateCodeType = intermediateRepresentation;
     TranslationOutput::makeCopy(output.intermediateRepresentation, igcOutput->GetOutput());
 
@@ -11,6 +11,8 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/mapped_file.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "cif/common/cif_main.h"
@@ -20,6 +22,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class Device;
@@ -32,6 +35,7 @@ struct TranslationInput {
     }
 
     bool allowCaching = false;
+    bool allowMappedCachedBinary = false;
 
     ArrayRef<const char> src;
     ArrayRef<const char> apiOptions;
@@ -65,6 +69,7 @@ struct TranslationOutput {
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::invalid;
     MemAndSize intermediateRepresentation;
     MemAndSize deviceBinary;
+    std::unique_ptr<MappedFile> mappedDeviceBinary;
     MemAndSize debugData;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
@@ -127,7 +132,8 @@ class CompilerInterface {
                                                        TranslationOutput &output);
 
     MOCKABLE_VIRTUAL TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device,
-                                                                       ArrayRef<const char> srcSpirV, SpecConstantInfo &output);
+                                                                       ArrayRef<const char> srcSpirV, SpecConstantInfo &output,
+                                                                       bool allowCaching);
 
     TranslationOutput::ErrorCode createLibrary(NEO::Device &device,
                                                const TranslationInput &input,
@@ -135,10 +141,16 @@ class CompilerInterface {
 
     MOCKABLE_VIRTUAL TranslationOutput::ErrorCode getSipKernelBinary(NEO::Device &device, SipKernelType type, std::vector<char> &retBinary);
 
+    static std::vector<char> serializeSpecConstants(const specConstValuesMap &specConstants);
+
   protected:
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgc();
+    bool loadFromCache(const std::string &kernelFileHash, const TranslationInput &input, TranslationOutput &output);
+    bool isStageCachingAllowed(const TranslationInput &input);
+    std::string getStageCacheKey(const NEO::Device &device, ConstStringRef stage, IGC::CodeType::CodeType_t outType, const TranslationInput &input);
+    bool loadStageOutputFromCache(const std::string &cacheKey, TranslationOutput::MemAndSize &output);
 
     static SpinLock spinlock;
     MOCKABLE_VIRTUAL std::unique_lock<SpinLock> lock() {
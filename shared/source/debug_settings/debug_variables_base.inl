@@ -25,6 +25,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpChangedPagesOnly, -1, "-1: default (0), 0: disabled, 1: skip unchanged pages of allocations not written by GPU when uploading memory in AUB/TBX mode, 2: skip unchanged pages of all allocations")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
@@ -34,6 +35,8 @@ DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpWriteInBackground, false, "Write AUB file from a background thread through double buffered output, flushes do not wait for disk I/O")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpCompression, false, "Write AUB file as compressed frames from a background thread to <file>z, use aub_decompress to restore the original AUB file")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableTimestampPacketOptimizations, false, "Allocate new allocation per node + dont reuse old nodes")
@@ -93,6 +96,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc a
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationMemoryPool, false, "Logs memory pool for allocations")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
+DECLARE_DEBUG_VARIABLE(bool, PrintWaitPolicyHistograms, false, "Prints per CSR histograms of wait times split by wait phase at CSR destruction")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
@@ -105,6 +109,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all ti
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the result of creation and destruction of BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
+DECLARE_DEBUG_VARIABLE(bool, PrintAllocationReuseStatistics, false, "prints hit and miss counts of the reusable allocations list when command stream receiver is destroyed and of the USM allocation reuse pool when SVM allocations manager is destroyed")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -124,6 +129,17 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr trac
 DECLARE_DEBUG_VARIABLE(int32_t, MaxHwThreadsPercent, 0, "If not zero then maximum number of used HW threads is capped to max * MaxHwThreadsPercent / 100")
 DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then maximum number of used HW threads is reduced by MinHwThreadsUnoccupied")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater then 0, driver performs implicit flush every N submissions.")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorMagazineSize, -1, "-1: default (32), 0: disabled, >0: number of free tags cached per thread in CSR tag allocators")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmAllocationReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled. Keeps freed device and host USM allocations in SVM allocations manager and reuses them for allocations of the same size class")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmAllocationReuseIdleTimeout, -1, "-1: default (1000), >=0: time in milliseconds after which unused allocations are released from USM allocation reuse pool")
+DECLARE_DEBUG_VARIABLE(int64_t, UsmAllocationReuseMaxSize, -1, "-1: default (256MB), >=0: max total size in bytes of allocations kept in USM allocation reuse pool")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePersistentDrmResidency, -1, "-1: default (enabled), 0: merge memory operations handler residency into every submission, 1: keep persistent exec object array per CSR")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncImmediateCommandLists, -1, "-1: default (follow command queue mode), 0: immediate command lists created with default mode wait after every append, 1: immediate command lists created with default mode submit without waiting")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandQueueMaxCmdBuffers, -1, "-1: default (8), >=2: max number of command buffers L0 command queue ring may grow to before waiting for the oldest one")
+DECLARE_DEBUG_VARIABLE(int64_t, CommandContainerReusePoolMaxSize, -1, "-1: default (64MB), >=0: max total size in bytes of completed command buffers and heaps kept for reuse by command containers of a device")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheSize, -1, "-1: default (8), 0: disabled, >0: number of group shapes per kernel whose generated local IDs are cached")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitPolicySpinTimeUs, -1, "-1: default (50), >=0: time in microseconds CSR and event waits spin before falling back to blocking wait")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWaitPolicyBlockingWait, -1, "-1: default (enabled), 0: waits without timeout keep polling after spin window, 1: waits without timeout block in kernel after spin window")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -10,6 +10,7 @@
 #include "shared/source/utilities/compiler_support.h"
 
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -106,6 +107,142 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+// XXH64 - processes input in four independent 64-bit lanes, 32 bytes per round.
+// Exposes the same interface as Hash, but results differ from it.
+class FastHash {
+  public:
+    FastHash() {
+        reset();
+    };
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr) {
+            return;
+        }
+
+        auto input = reinterpret_cast<const uint8_t *>(buff);
+        totalSize += size;
+
+        if (bufferedSize + size < stripeSize) {
+            memcpy(buffer + bufferedSize, input, size);
+            bufferedSize += size;
+            return;
+        }
+
+        if (bufferedSize > 0) {
+            auto toFill = stripeSize - bufferedSize;
+            memcpy(buffer + bufferedSize, input, toFill);
+            consumeStripe(buffer);
+            input += toFill;
+            size -= toFill;
+            bufferedSize = 0;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(input);
+            input += stripeSize;
+            size -= stripeSize;
+        }
+
+        memcpy(buffer, input, size);
+        bufferedSize = size;
+    }
+
+    uint64_t finish() const {
+        uint64_t result = 0;
+        if (totalSize >= stripeSize) {
+            result = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+            for (auto lane : lanes) {
+                result ^= round(0, lane);
+                result = result * prime1 + prime4;
+            }
+        } else {
+            result = lanes[2] + prime5;
+        }
+        result += totalSize;
+
+        const uint8_t *tail = buffer;
+        size_t tailSize = bufferedSize;
+        while (tailSize >= sizeof(uint64_t)) {
+            result ^= round(0, read<uint64_t>(tail));
+            result = rotateLeft(result, 27) * prime1 + prime4;
+            tail += sizeof(uint64_t);
+            tailSize -= sizeof(uint64_t);
+        }
+        if (tailSize >= sizeof(uint32_t)) {
+            result ^= static_cast<uint64_t>(read<uint32_t>(tail)) * prime1;
+            result = rotateLeft(result, 23) * prime2 + prime3;
+            tail += sizeof(uint32_t);
+            tailSize -= sizeof(uint32_t);
+        }
+        while (tailSize > 0) {
+            result ^= static_cast<uint64_t>(*tail) * prime5;
+            result = rotateLeft(result, 11) * prime1;
+            tail++;
+            tailSize--;
+        }
+
+        result ^= result >> 33;
+        result *= prime2;
+        result ^= result >> 29;
+        result *= prime3;
+        result ^= result >> 32;
+        return result;
+    }
+
+    void reset() {
+        lanes[0] = prime1 + prime2;
+        lanes[1] = prime2;
+        lanes[2] = 0;
+        lanes[3] = 0 - prime1;
+        totalSize = 0;
+        bufferedSize = 0;
+    }
+
+    static uint64_t hash(const char *buff, size_t size) {
+        FastHash hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+    static constexpr size_t stripeSize = 32;
+
+    static uint64_t rotateLeft(uint64_t value, uint32_t shift) {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    static uint64_t round(uint64_t accumulator, uint64_t input) {
+        accumulator += input * prime2;
+        accumulator = rotateLeft(accumulator, 31);
+        return accumulator * prime1;
+    }
+
+    template <typename T>
+    static T read(const uint8_t *ptr) {
+        T value;
+        memcpy(&value, ptr, sizeof(T));
+        return value;
+    }
+
+    void consumeStripe(const uint8_t *stripe) {
+        lanes[0] = round(lanes[0], read<uint64_t>(stripe));
+        lanes[1] = round(lanes[1], read<uint64_t>(stripe + 8));
+        lanes[2] = round(lanes[2], read<uint64_t>(stripe + 16));
+        lanes[3] = round(lanes[3], read<uint64_t>(stripe + 24));
+    }
+
+    uint64_t lanes[4];
+    uint64_t totalSize;
+    uint8_t buffer[stripeSize];
+    size_t bufferedSize;
+};
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/heap_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
@@ -32,4 +33,29 @@ GraphicsAllocation *HeapHelper::getHeapAllocation(uint32_t heapType, size_t heap
 void HeapHelper::storeHeapAllocation(GraphicsAllocation *heapAllocation) {
     this->storageForReuse->storeAllocation(std::unique_ptr<NEO::GraphicsAllocation>(heapAllocation), NEO::AllocationUsage::REUSABLE_ALLOCATION);
 }
+
+GraphicsAllocation *HeapHelper::getCommandBufferAllocation(size_t size, uint32_t rootDeviceIndex) {
+    auto allocation = this->storageForReuse->obtainReusableAllocation(size, GraphicsAllocation::AllocationType::COMMAND_BUFFER);
+    if (allocation) {
+        return allocation.release();
+    }
+    NEO::AllocationProperties properties{rootDeviceIndex, true, size, GraphicsAllocation::AllocationType::COMMAND_BUFFER, isMultiOsContextCapable, false, storageForReuse->getDeviceBitfield()};
+
+    return this->memManager->allocateGraphicsMemoryWithProperties(properties);
+}
+
+void HeapHelper::storeCommandBufferAllocation(GraphicsAllocation *cmdBufferAllocation) {
+    this->storageForReuse->storeAllocation(std::unique_ptr<NEO::GraphicsAllocation>(cmdBufferAllocation), NEO::AllocationUsage::REUSABLE_ALLOCATION);
+}
+
+void HeapHelper::trimStorageForReuse() {
+    this->storageForReuse->trimAllocationsForReuse(getMaxStorageForReuseSize());
+}
+
+size_t HeapHelper::getMaxStorageForReuseSize() {
+    if (DebugManager.flags.CommandContainerReusePoolMaxSize.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.CommandContainerReusePoolMaxSize.get());
+    }
+    return static_cast<size_t>(64 * MemoryConstants::megaByte);
+}
 } // namespace NEO
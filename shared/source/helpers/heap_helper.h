@@ -22,6 +22,10 @@ class HeapHelper {
                                                                                                                       memManager(memManager) {}
     GraphicsAllocation *getHeapAllocation(uint32_t heapType, size_t heapSize, size_t alignment, uint32_t rootDeviceIndex);
     void storeHeapAllocation(GraphicsAllocation *heapAllocation);
+    GraphicsAllocation *getCommandBufferAllocation(size_t size, uint32_t rootDeviceIndex);
+    void storeCommandBufferAllocation(GraphicsAllocation *cmdBufferAllocation);
+    void trimStorageForReuse();
+    static size_t getMaxStorageForReuseSize();
     bool isMultiOsContextCapable = false;
 
   protected:
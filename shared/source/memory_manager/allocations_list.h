@@ -9,19 +9,68 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <atomic>
+#include <list>
+#include <map>
 #include <mutex>
+#include <utility>
 
 namespace NEO {
 class CommandStreamReceiver;
 
 class AllocationsList : public IDList<GraphicsAllocation, true, true> {
   public:
+    using BaseClass = IDList<GraphicsAllocation, true, true>;
+
     AllocationsList(AllocationUsage allocationUsage);
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
 
-  private:
+    // list modifiers are shadowed to keep the reuse index in sync
+    void pushFrontOne(GraphicsAllocation &allocation);
+    void pushTailOne(GraphicsAllocation &allocation);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &allocation);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &allocations);
+
+    uint64_t getReuseHits() const { return reuseHits; }
+    uint64_t getReuseMisses() const { return reuseMisses; }
+    size_t getReusableSize() const { return reusableSize; }
+
+  protected:
+    // reusable allocations are indexed by type and power-of-two size class,
+    // each bucket holds allocations in the order they were stored (task count order)
+    using ReuseIndexKey = std::pair<GraphicsAllocation::AllocationType, uint32_t>;
+    struct ReuseIndexEntry {
+        int64_t sequenceNumber;
+        GraphicsAllocation *allocation;
+        size_t size;
+    };
+    using ReuseIndexBucket = std::list<ReuseIndexEntry>;
+
+    static uint32_t getSizeClass(size_t size);
+    bool isReuseIndexEnabled() const { return allocationUsage == REUSABLE_ALLOCATION; }
+    void addToReuseIndex(GraphicsAllocation *allocations, bool atFront);
+    void removeFromReuseIndex(GraphicsAllocation *allocation);
+    void rebuildReuseIndex();
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachIndexedAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *first, void *last);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *allocations, void *);
 
     const AllocationUsage allocationUsage;
+    std::map<ReuseIndexKey, ReuseIndexBucket> reuseIndex;
+    int64_t nextTailSequenceNumber = 0;
+    int64_t nextFrontSequenceNumber = -1;
+    std::atomic<uint64_t> reuseHits{0};
+    std::atomic<uint64_t> reuseMisses{0};
+    std::atomic<size_t> reusableSize{0}; // bytes held by indexed allocations
 };
 } // namespace NEO
@@ -12,6 +12,8 @@ namespace NEO {
 namespace EngineLimits {
 
 constexpr uint32_t maxHandleCount = 1u;
+// per context data is kept inline up to this many OS contexts (engines of a single device), heap allocated above
+constexpr uint32_t maxInlineOsContextCount = 6u;
 
 }; // namespace EngineLimits
 } // namespace NEO
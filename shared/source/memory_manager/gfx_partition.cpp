@@ -40,7 +40,7 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size) {
         size -= 2 * GfxPartition::heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + GfxPartition::heapGranularity, size);
+    alloc = std::make_unique<OrderedHeapAllocator>(base + GfxPartition::heapGranularity, size);
 }
 
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
@@ -8,7 +8,7 @@
 #pragma once
 #include "shared/source/helpers/constants.h"
 #include "shared/source/os_interface/os_memory.h"
-#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/ordered_heap_allocator.h"
 
 #include <array>
 
@@ -83,7 +83,7 @@ class GfxPartition {
 
       protected:
         uint64_t base = 0, size = 0;
-        std::unique_ptr<HeapAllocator> alloc;
+        std::unique_ptr<OrderedHeapAllocator> alloc;
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
@@ -317,7 +317,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     MemoryPool::Type memoryPool = MemoryPool::MemoryNull;
     AllocationType allocationType = AllocationType::UNKNOWN;
 
-    StackVec<UsageInfo, 32> usageInfos;
+    StackVec<UsageInfo, EngineLimits::maxInlineOsContextCount> usageInfos;
     std::atomic<uint32_t> registeredContextsNum{0};
     StackVec<Gmm *, EngineLimits::maxHandleCount> gmms;
 };
@@ -8,9 +8,13 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver)
@@ -18,6 +22,13 @@ InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &comm
       temporaryAllocations(TEMPORARY_ALLOCATION),
       allocationsForReuse(REUSABLE_ALLOCATION){};
 
+InternalAllocationStorage::~InternalAllocationStorage() {
+    printDebugString(DebugManager.flags.PrintAllocationReuseStatistics.get(), stdout,
+                     "Allocation reuse statistics: hits: %llu, misses: %llu\n",
+                     static_cast<unsigned long long>(allocationsForReuse.getReuseHits()),
+                     static_cast<unsigned long long>(allocationsForReuse.getReuseMisses()));
+}
+
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
     uint32_t taskCount = gfxAllocation->getTaskCount(commandStreamReceiver.getOsContext().getContextId());
 
@@ -65,6 +76,39 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
     }
 }
 
+void InternalAllocationStorage::trimAllocationsForReuse(size_t maxReusableSize) {
+    if (allocationsForReuse.getReusableSize() <= maxReusableSize) {
+        return;
+    }
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    auto tagValue = *commandStreamReceiver.getTagAddress();
+    auto sizeLeft = allocationsForReuse.getReusableSize();
+    GraphicsAllocation *curr = allocationsForReuse.detachNodes();
+
+    // oldest allocations are released first, the ones still used by any engine are kept
+    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        auto size = curr->getUnderlyingBufferSize();
+        if (sizeLeft > maxReusableSize &&
+            curr->getTaskCount(contextId) <= tagValue &&
+            !memoryManager->allocInUse(*curr)) {
+            sizeLeft -= std::min(size, sizeLeft);
+            memoryManager->freeGraphicsMemory(curr);
+        } else {
+            allocationsLeft.pushTailOne(*curr);
+        }
+        curr = next;
+    }
+
+    if (allocationsLeft.peekIsEmpty() == false) {
+        allocationsForReuse.splice(*allocationsLeft.detachNodes());
+    }
+}
+
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
     auto allocation = allocationsForReuse.detachAllocation(requiredSize, nullptr, commandStreamReceiver, allocationType);
     return allocation;
@@ -81,8 +125,14 @@ struct ReusableAllocationRequirements {
     GraphicsAllocation::AllocationType allocationType;
     uint32_t contextId;
     const void *requiredPtr;
+    MemoryManager *memoryManager;
 };
 
+// allocations that other engines submitted are reusable once every engine completed them
+static bool isCompletedOnOtherEngines(GraphicsAllocation &allocation, const ReusableAllocationRequirements &req) {
+    return !allocation.isUsedByManyOsContexts() || !req.memoryManager->allocInUse(allocation);
+}
+
 AllocationsList::AllocationsList(AllocationUsage allocationUsage)
     : allocationUsage(allocationUsage) {}
 
@@ -93,8 +143,14 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
     req.allocationType = allocationType;
     req.contextId = commandStreamReceiver.getOsContext().getContextId();
     req.requiredPtr = requiredPtr;
+    req.memoryManager = commandStreamReceiver.getMemoryManager();
     GraphicsAllocation *a = nullptr;
-    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    GraphicsAllocation *retAlloc = nullptr;
+    if (isReuseIndexEnabled() && requiredPtr == nullptr) {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachIndexedAllocationImpl>(a, static_cast<void *>(&req));
+    } else {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    }
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
 }
 
@@ -104,12 +160,15 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     while (curr != nullptr) {
         if ((req->allocationType == curr->getAllocationType()) &&
             (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (this->allocationUsage == TEMPORARY_ALLOCATION || *req->csrTagAddress >= curr->getTaskCount(req->contextId)) &&
+            (this->allocationUsage == TEMPORARY_ALLOCATION || (*req->csrTagAddress >= curr->getTaskCount(req->contextId) && isCompletedOnOtherEngines(*curr, *req))) &&
             (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
             if (this->allocationUsage == TEMPORARY_ALLOCATION) {
                 // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                 curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
             }
+            if (isReuseIndexEnabled()) {
+                return removeOneIndexedImpl(curr, nullptr);
+            }
             return removeOneImpl(curr, nullptr);
         }
         curr = curr->next;
@@ -117,6 +176,181 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     return nullptr;
 }
 
+GraphicsAllocation *AllocationsList::detachIndexedAllocationImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+
+    auto bestBucket = reuseIndex.end();
+    ReuseIndexBucket::iterator bestEntry;
+
+    // buckets below the required size class can't hold a big enough allocation
+    for (auto bucket = reuseIndex.lower_bound({req->allocationType, getSizeClass(req->requiredMinimalSize)});
+         bucket != reuseIndex.end() && bucket->first.first == req->allocationType; ++bucket) {
+        for (auto entry = bucket->second.begin(); entry != bucket->second.end(); ++entry) {
+            auto allocation = entry->allocation;
+            if ((allocation->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
+                (*req->csrTagAddress >= allocation->getTaskCount(req->contextId)) &&
+                isCompletedOnOtherEngines(*allocation, *req)) {
+                if (bestBucket == reuseIndex.end() || entry->sequenceNumber < bestEntry->sequenceNumber) {
+                    bestBucket = bucket;
+                    bestEntry = entry;
+                }
+                break;
+            }
+        }
+    }
+
+    if (bestBucket == reuseIndex.end()) {
+        reuseMisses++;
+        return nullptr;
+    }
+    reuseHits++;
+
+    auto allocation = bestEntry->allocation;
+    reusableSize -= bestEntry->size;
+    bestBucket->second.erase(bestEntry);
+    if (bestBucket->second.empty()) {
+        reuseIndex.erase(bestBucket);
+    }
+    return BaseClass::removeOneImpl(allocation, nullptr);
+}
+
+uint32_t AllocationsList::getSizeClass(size_t size) {
+    return (size == 0) ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+void AllocationsList::addToReuseIndex(GraphicsAllocation *allocations, bool atFront) {
+    if (atFront) {
+        auto size = allocations->getUnderlyingBufferSize();
+        auto &bucket = reuseIndex[{allocations->getAllocationType(), getSizeClass(size)}];
+        bucket.push_front({nextFrontSequenceNumber--, allocations, size});
+        reusableSize += size;
+        return;
+    }
+    for (auto allocation = allocations; allocation != nullptr; allocation = allocation->next) {
+        auto size = allocation->getUnderlyingBufferSize();
+        auto &bucket = reuseIndex[{allocation->getAllocationType(), getSizeClass(size)}];
+        bucket.push_back({nextTailSequenceNumber++, allocation, size});
+        reusableSize += size;
+    }
+}
+
+void AllocationsList::removeFromReuseIndex(GraphicsAllocation *allocation) {
+    auto removeFromBucket = [&](std::map<ReuseIndexKey, ReuseIndexBucket>::iterator bucket) {
+        for (auto entry = bucket->second.begin(); entry != bucket->second.end(); ++entry) {
+            if (entry->allocation == allocation) {
+                reusableSize -= entry->size;
+                bucket->second.erase(entry);
+                if (bucket->second.empty()) {
+                    reuseIndex.erase(bucket);
+                }
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto bucket = reuseIndex.find({allocation->getAllocationType(), getSizeClass(allocation->getUnderlyingBufferSize())});
+    if (bucket != reuseIndex.end() && removeFromBucket(bucket)) {
+        return;
+    }
+    // size of the allocation changed after it was stored, fall back to a full search
+    for (bucket = reuseIndex.begin(); bucket != reuseIndex.end(); ++bucket) {
+        if (removeFromBucket(bucket)) {
+            return;
+        }
+    }
+}
+
+void AllocationsList::rebuildReuseIndex() {
+    reuseIndex.clear();
+    reusableSize = 0;
+    nextTailSequenceNumber = 0;
+    nextFrontSequenceNumber = -1;
+    if (head != nullptr) {
+        addToReuseIndex(head, false);
+    }
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &allocation) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&allocation);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &allocation) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&allocation);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &allocation) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&allocation));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &allocations) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&allocations);
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    BaseClass::pushFrontOneImpl(allocation, nullptr);
+    if (isReuseIndexEnabled()) {
+        addToReuseIndex(allocation, true);
+    }
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    BaseClass::pushTailOneImpl(allocation, nullptr);
+    if (isReuseIndexEnabled()) {
+        addToReuseIndex(allocation, false);
+    }
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    if (isReuseIndexEnabled()) {
+        removeFromReuseIndex(allocation);
+    }
+    return BaseClass::removeOneImpl(allocation, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *first, void *last) {
+    auto allocations = BaseClass::detachSequenceImpl(first, last);
+    if (isReuseIndexEnabled()) {
+        rebuildReuseIndex();
+    }
+    return allocations;
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    reuseIndex.clear();
+    reusableSize = 0;
+    return BaseClass::detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *allocations, void *) {
+    BaseClass::spliceImpl(allocations, nullptr);
+    if (isReuseIndexEnabled()) {
+        addToReuseIndex(allocations, false);
+    }
+    return nullptr;
+}
+
 DeviceBitfield InternalAllocationStorage::getDeviceBitfield() const {
     return commandStreamReceiver.getOsContext().getDeviceBitfield();
 }
@@ -13,9 +13,10 @@ namespace NEO {
 
 class InternalAllocationStorage {
   public:
-    MOCKABLE_VIRTUAL ~InternalAllocationStorage() = default;
+    MOCKABLE_VIRTUAL ~InternalAllocationStorage();
     InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL void cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage);
+    void trimAllocationsForReuse(size_t maxReusableSize);
     void storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage);
     void storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage, uint32_t taskCount);
     std::unique_ptr<GraphicsAllocation> obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType);
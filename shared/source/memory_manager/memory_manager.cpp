@@ -188,6 +188,10 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
         freeAssociatedResourceImpl(*gfxAllocation);
     }
 
+    for (auto &engine : registeredEngines) {
+        engine.commandStreamReceiver->invalidateAllocationPages(*gfxAllocation);
+    }
+
     localMemoryUsageBankSelector[gfxAllocation->getRootDeviceIndex()]->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
     freeGraphicsMemoryImpl(gfxAllocation);
 }
@@ -561,16 +565,29 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
         auto allocationTaskCount = graphicsAllocation.getTaskCount(osContextId);
         if (graphicsAllocation.isUsedByOsContext(osContextId) &&
             allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
-            engine.commandStreamReceiver->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, allocationTaskCount);
+            // flush stamp of allocation's last use is not tracked, do not block behind later submissions
+            engine.commandStreamReceiver->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, allocationTaskCount, 0);
         }
     }
 }
 
+bool MemoryManager::allocInUse(GraphicsAllocation &graphicsAllocation) {
+    for (auto &engine : getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto allocationTaskCount = graphicsAllocation.getTaskCount(osContextId);
+        if (graphicsAllocation.isUsedByOsContext(osContextId) &&
+            allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
     for (auto &engine : getRegisteredEngines()) {
         auto csr = engine.commandStreamReceiver;
         if (waitForCompletion) {
-            csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount());
+            csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount(), csr->obtainCurrentFlushStamp());
         }
         csr->getInternalAllocationStorage()->cleanAllocationList(*csr->getTagAddress(), AllocationUsage::TEMPORARY_ALLOCATION);
     }
@@ -8,18 +8,20 @@
 #pragma once
 #include "shared/source/utilities/stackvec.h"
 
-#include <vector>
+#include "engine_limits.h"
 
 namespace NEO {
 
 struct ResidencyData {
-    ResidencyData(size_t maxOsContextCount) : resident(maxOsContextCount, 0), lastFenceValues(static_cast<size_t>(maxOsContextCount)) {}
-    std::vector<bool> resident;
+    ResidencyData(size_t maxOsContextCount) : lastFenceValues(maxOsContextCount) {
+        resident.resize(maxOsContextCount, false);
+    }
+    StackVec<uint8_t, EngineLimits::maxInlineOsContextCount> resident; // bool per OS context
 
     void updateCompletionData(uint64_t newFenceValue, uint32_t contextId);
     uint64_t getFenceValueForContextId(uint32_t contextId);
 
   protected:
-    StackVec<uint64_t, 32> lastFenceValues;
+    StackVec<uint64_t, EngineLimits::maxInlineOsContextCount> lastFenceValues;
 };
 } // namespace NEO
@@ -8,21 +8,75 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
+#include <algorithm>
+
 namespace NEO {
 
+std::atomic<uint64_t> SVMAllocsManager::MapBasedAllocationTracker::trackerIdCounter{0};
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
     allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
+    lookupSnapshot.reset();
+    staleLookupsCount = 0u;
+    layoutVersion.fetch_add(1u, std::memory_order_release);
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     allocations.erase(iter);
+    lookupSnapshot.reset();
+    staleLookupsCount = 0u;
+    layoutVersion.fetch_add(1u, std::memory_order_release);
+}
+
+std::shared_ptr<const SVMAllocsManager::MapBasedAllocationTracker::LookupSnapshot> SVMAllocsManager::MapBasedAllocationTracker::getLookupSnapshot() {
+    if (lookupSnapshot) {
+        return lookupSnapshot;
+    }
+    // Don't rebuild while allocations are still being created or freed, the map lookup
+    // is cheaper than copying all ranges for a layout that is about to change again.
+    if (++staleLookupsCount < lookupSnapshotRebuildThreshold) {
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<LookupSnapshot>();
+    snapshot->layoutVersion = layoutVersion.load(std::memory_order_relaxed);
+    snapshot->ranges.reserve(allocations.size());
+    for (auto &allocation : allocations) {
+        snapshot->ranges.push_back({reinterpret_cast<uintptr_t>(allocation.first), allocation.second.size, &allocation.second});
+    }
+    lookupSnapshot = std::move(snapshot);
+    return lookupSnapshot;
+}
+
+const SVMAllocsManager::MapBasedAllocationTracker::AllocationRange *SVMAllocsManager::MapBasedAllocationTracker::LookupSnapshot::find(uintptr_t address) const {
+    auto next = std::upper_bound(ranges.begin(), ranges.end(), address,
+                                 [](uintptr_t address, const AllocationRange &range) { return address < range.base; });
+    if (next == ranges.begin()) {
+        return nullptr;
+    }
+    auto candidate = next - 1;
+    return candidate->contains(address) ? &*candidate : nullptr;
+}
+
+SvmAllocationData *SVMAllocsManager::ThreadLookupCacheEntry::find(const void *ptr) {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    if (lastHit && lastHit->contains(address)) {
+        return lastHit->allocData;
+    }
+    auto range = snapshot->find(address);
+    if (range == nullptr) {
+        return nullptr;
+    }
+    lastHit = range;
+    return range->allocData;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -74,6 +128,12 @@ void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootD
                                                                   ResidencyContainer &residencyContainer,
                                                                   uint32_t requestedTypesMask) {
     std::unique_lock<SpinLock> lock(mtx);
+    collectInternalAllocations(rootDeviceIndex, residencyContainer, requestedTypesMask);
+}
+
+void SVMAllocsManager::collectInternalAllocations(uint32_t rootDeviceIndex,
+                                                  ResidencyContainer &residencyContainer,
+                                                  uint32_t requestedTypesMask) {
     for (auto &allocation : this->SVMAllocs.allocations) {
         if (rootDeviceIndex >= allocation.second.gpuAllocations.getGraphicsAllocations().size()) {
             continue;
@@ -87,6 +147,32 @@ void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootD
     }
 }
 
+std::shared_ptr<const SVMAllocsManager::IndirectResidencySnapshot> SVMAllocsManager::getIndirectResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask) {
+    std::unique_lock<SpinLock> lock(mtx);
+    auto layoutVersion = SVMAllocs.getLayoutVersion();
+
+    auto snapshotIt = std::find_if(indirectResidencySnapshots.begin(), indirectResidencySnapshots.end(),
+                                   [&](const std::shared_ptr<const IndirectResidencySnapshot> &snapshot) {
+                                       return snapshot->rootDeviceIndex == rootDeviceIndex && snapshot->requestedTypesMask == requestedTypesMask;
+                                   });
+    if (snapshotIt != indirectResidencySnapshots.end() && (*snapshotIt)->layoutVersion == layoutVersion) {
+        return *snapshotIt;
+    }
+
+    auto snapshot = std::make_shared<IndirectResidencySnapshot>();
+    snapshot->layoutVersion = layoutVersion;
+    snapshot->rootDeviceIndex = rootDeviceIndex;
+    snapshot->requestedTypesMask = requestedTypesMask;
+    collectInternalAllocations(rootDeviceIndex, snapshot->allocations, requestedTypesMask);
+
+    if (snapshotIt != indirectResidencySnapshots.end()) {
+        *snapshotIt = snapshot;
+    } else {
+        indirectResidencySnapshots.push_back(snapshot);
+    }
+    return snapshot;
+}
+
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
     std::unique_lock<SpinLock> lock(mtx);
     for (auto &allocation : this->SVMAllocs.allocations) {
@@ -99,6 +185,27 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
 }
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager) {
+    usmReusePool.enabled = DebugManager.flags.EnableUsmAllocationReuse.get() == 1;
+    usmReusePool.maxSize = 256 * MemoryConstants::megaByte;
+    if (DebugManager.flags.UsmAllocationReuseMaxSize.get() != -1) {
+        usmReusePool.maxSize = static_cast<size_t>(DebugManager.flags.UsmAllocationReuseMaxSize.get());
+    }
+    usmReusePool.idleTimeout = std::chrono::milliseconds(1000);
+    if (DebugManager.flags.UsmAllocationReuseIdleTimeout.get() != -1) {
+        usmReusePool.idleTimeout = std::chrono::milliseconds(DebugManager.flags.UsmAllocationReuseIdleTimeout.get());
+    }
+}
+
+SVMAllocsManager::~SVMAllocsManager() {
+    releaseUsmReusePool();
+    if (usmReusePool.enabled) {
+        auto statistics = getUsmReuseStatistics();
+        printDebugString(DebugManager.flags.PrintAllocationReuseStatistics.get(), stdout,
+                         "USM allocation reuse pool: hits %llu, misses %llu, released %llu\n",
+                         static_cast<unsigned long long>(statistics.hits),
+                         static_cast<unsigned long long>(statistics.misses),
+                         static_cast<unsigned long long>(statistics.releasedAllocations));
+    }
 }
 
 void *SVMAllocsManager::createSVMAlloc(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties svmProperties, const DeviceBitfield &deviceBitfield) {
@@ -138,9 +245,21 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(uint32_t maxRootDevice
                                                  memoryProperties.subdeviceBitfield};
     unifiedMemoryProperties.flags.shareable = memoryProperties.allocationFlags.flags.shareable;
 
+    UsmReuseKey reuseKey{memoryProperties.memoryType, allocationType, maxRootDeviceIndex, alignedSize,
+                         memoryProperties.subdeviceBitfield.to_ulong(), !!memoryProperties.allocationFlags.flags.shareable};
+    if (usmReusePool.enabled) {
+        auto reusedPtr = obtainFromUsmReusePool(reuseKey, size, memoryProperties, nullptr);
+        if (reusedPtr) {
+            return reusedPtr;
+        }
+    }
+
     SvmAllocationData allocData(maxRootDeviceIndex);
 
     void *usmPtr = memoryManager->createMultiGraphicsAllocation(rootDeviceIndices, unifiedMemoryProperties, allocData.gpuAllocations);
+    if (!usmPtr && trimUsmReusePoolOnAllocationFailure()) {
+        usmPtr = memoryManager->createMultiGraphicsAllocation(rootDeviceIndices, unifiedMemoryProperties, allocData.gpuAllocations);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -153,6 +272,7 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(uint32_t maxRootDevice
 
     std::unique_lock<SpinLock> lock(mtx);
     this->SVMAllocs.insert(allocData);
+    registerReusableAllocation(usmPtr, reuseKey);
 
     return usmPtr;
 }
@@ -182,7 +302,19 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(uint32_t rootDeviceIndex,
     unifiedMemoryProperties.flags.shareable = memoryProperties.allocationFlags.flags.shareable;
     unifiedMemoryProperties.flags.isUSMDeviceAllocation = true;
 
+    UsmReuseKey reuseKey{memoryProperties.memoryType, allocationType, rootDeviceIndex, alignedSize,
+                         memoryProperties.subdeviceBitfield.to_ulong(), !!memoryProperties.allocationFlags.flags.shareable};
+    if (usmReusePool.enabled) {
+        auto reusedPtr = obtainFromUsmReusePool(reuseKey, size, memoryProperties, memoryProperties.device);
+        if (reusedPtr) {
+            return reusedPtr;
+        }
+    }
+
     GraphicsAllocation *unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+    if (!unifiedMemoryAllocation && trimUsmReusePoolOnAllocationFailure()) {
+        unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+    }
     if (!unifiedMemoryAllocation) {
         return nullptr;
     }
@@ -195,9 +327,11 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(uint32_t rootDeviceIndex,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = memoryProperties.device;
 
+    auto usmPtr = reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
     std::unique_lock<SpinLock> lock(mtx);
     this->SVMAllocs.insert(allocData);
-    return reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
+    registerReusableAllocation(usmPtr, reuseKey);
+    return usmPtr;
 }
 
 void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(uint32_t rootDeviceIndex,
@@ -229,8 +363,42 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(uint32_t rootDeviceI
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
+    auto &cacheEntry = getThreadLookupCacheEntry();
+    if (cacheEntry.snapshot && cacheEntry.snapshot->layoutVersion == SVMAllocs.getLayoutVersion()) {
+        return cacheEntry.find(ptr);
+    }
+
     std::unique_lock<SpinLock> lock(mtx);
-    return SVMAllocs.get(ptr);
+    auto snapshot = SVMAllocs.getLookupSnapshot();
+    if (snapshot == nullptr) {
+        return SVMAllocs.get(ptr);
+    }
+    lock.unlock();
+
+    cacheEntry.snapshot = std::move(snapshot);
+    cacheEntry.lastHit = nullptr;
+    return cacheEntry.find(ptr);
+}
+
+// Snapshots and last hits are cached per thread, so lookups of an unchanged set of
+// allocations don't touch the manager's lock or any shared cache line.
+SVMAllocsManager::ThreadLookupCacheEntry &SVMAllocsManager::getThreadLookupCacheEntry() {
+    thread_local ThreadLookupCacheEntry threadLookupCache[threadLookupCacheSize];
+    thread_local size_t nextCacheEntry = 0;
+
+    auto trackerId = SVMAllocs.getTrackerId();
+    for (auto &entry : threadLookupCache) {
+        if (entry.trackerId == trackerId) {
+            return entry;
+        }
+    }
+
+    auto &entry = threadLookupCache[nextCacheEntry];
+    nextCacheEntry = (nextCacheEntry + 1) % threadLookupCacheSize;
+    entry.trackerId = trackerId;
+    entry.snapshot.reset();
+    entry.lastHit = nullptr;
+    return entry;
 }
 
 void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
@@ -258,6 +426,9 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
             pageFaultManager->removeAllocation(ptr);
         }
         std::unique_lock<SpinLock> lock(mtx);
+        if (storeInUsmReusePool(ptr, *svmData)) {
+            return true;
+        }
         if (svmData->gpuAllocations.getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
             freeZeroCopySvmAllocation(svmData);
         } else {
@@ -356,6 +527,119 @@ void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svm
     memoryManager->freeGraphicsMemory(cpuAllocation);
 }
 
+SVMAllocsManager::UsmReuseStatistics SVMAllocsManager::getUsmReuseStatistics() {
+    std::unique_lock<SpinLock> lock(mtx);
+    return usmReusePool.statistics;
+}
+
+void SVMAllocsManager::releaseUsmReusePool() {
+    std::unique_lock<SpinLock> lock(mtx);
+    trimUsmReusePool(true);
+}
+
+void *SVMAllocsManager::obtainFromUsmReusePool(const UsmReuseKey &key, size_t size, const UnifiedMemoryProperties &memoryProperties, void *device) {
+    std::unique_lock<SpinLock> lock(mtx);
+    trimUsmReusePool(false);
+
+    auto candidates = usmReusePool.entries.equal_range(key);
+    for (auto entry = candidates.first; entry != candidates.second; entry++) {
+        auto &allocData = *entry->second.allocData;
+        if (isUsmAllocationInUse(allocData)) {
+            continue;
+        }
+        allocData.size = size;
+        allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
+        allocData.device = device;
+        SVMAllocs.insert(allocData);
+
+        auto usmPtr = entry->second.usmPtr;
+        usmReusePool.reusableAllocations.emplace(usmPtr, key);
+        usmReusePool.statistics.pooledSize -= key.alignedSize;
+        usmReusePool.statistics.hits++;
+        usmReusePool.entries.erase(entry);
+        return usmPtr;
+    }
+    usmReusePool.statistics.misses++;
+    return nullptr;
+}
+
+void SVMAllocsManager::registerReusableAllocation(const void *usmPtr, const UsmReuseKey &key) {
+    if (usmReusePool.enabled) {
+        usmReusePool.reusableAllocations.emplace(usmPtr, key);
+    }
+}
+
+bool SVMAllocsManager::storeInUsmReusePool(void *ptr, SvmAllocationData &svmData) {
+    auto reusableAllocation = usmReusePool.reusableAllocations.find(ptr);
+    if (reusableAllocation == usmReusePool.reusableAllocations.end()) {
+        return false;
+    }
+    auto key = reusableAllocation->second;
+    usmReusePool.reusableAllocations.erase(reusableAllocation);
+    if (key.alignedSize > usmReusePool.maxSize) {
+        return false;
+    }
+
+    UsmReuseEntry entry;
+    entry.allocData = std::make_unique<SvmAllocationData>(svmData);
+    entry.usmPtr = ptr;
+    entry.releaseTime = std::chrono::steady_clock::now();
+    SVMAllocs.remove(svmData);
+
+    usmReusePool.entries.emplace(key, std::move(entry));
+    usmReusePool.statistics.pooledSize += key.alignedSize;
+    trimUsmReusePool(false);
+    return true;
+}
+
+bool SVMAllocsManager::trimUsmReusePool(bool releaseAll) {
+    auto releaseEntry = [this](std::multimap<UsmReuseKey, UsmReuseEntry>::iterator entry) {
+        for (auto gpuAllocation : entry->second.allocData->gpuAllocations.getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(gpuAllocation);
+        }
+        usmReusePool.statistics.pooledSize -= entry->first.alignedSize;
+        usmReusePool.statistics.releasedAllocations++;
+        return usmReusePool.entries.erase(entry);
+    };
+
+    bool released = false;
+    auto now = std::chrono::steady_clock::now();
+    for (auto entry = usmReusePool.entries.begin(); entry != usmReusePool.entries.end();) {
+        if (releaseAll || (now - entry->second.releaseTime >= usmReusePool.idleTimeout)) {
+            entry = releaseEntry(entry);
+            released = true;
+        } else {
+            entry++;
+        }
+    }
+    while (usmReusePool.statistics.pooledSize > usmReusePool.maxSize) {
+        auto oldestEntry = std::min_element(usmReusePool.entries.begin(), usmReusePool.entries.end(),
+                                            [](const std::pair<const UsmReuseKey, UsmReuseEntry> &lhs, const std::pair<const UsmReuseKey, UsmReuseEntry> &rhs) {
+                                                return lhs.second.releaseTime < rhs.second.releaseTime;
+                                            });
+        releaseEntry(oldestEntry);
+        released = true;
+    }
+    return released;
+}
+
+bool SVMAllocsManager::trimUsmReusePoolOnAllocationFailure() {
+    if (!usmReusePool.enabled) {
+        return false;
+    }
+    std::unique_lock<SpinLock> lock(mtx);
+    return trimUsmReusePool(true);
+}
+
+bool SVMAllocsManager::isUsmAllocationInUse(SvmAllocationData &svmData) {
+    for (auto gpuAllocation : svmData.gpuAllocations.getGraphicsAllocations()) {
+        if (gpuAllocation && memoryManager->allocInUse(*gpuAllocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 SvmMapOperation *SVMAllocsManager::getSvmMapOperation(const void *ptr) {
     std::unique_lock<SpinLock> lock(mtx);
     return svmMapOperations.get(ptr);
@@ -14,9 +14,15 @@
 
 #include "memory_properties_flags.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -64,13 +70,42 @@ class SVMAllocsManager {
 
       public:
         using SvmAllocationContainer = std::map<const void *, SvmAllocationData>;
+
+        struct AllocationRange {
+            bool contains(uintptr_t address) const { return (address >= base) && (address - base < size); }
+            uintptr_t base;
+            size_t size;
+            SvmAllocationData *allocData;
+        };
+
+        // Immutable, sorted copy of the tracked ranges. Readers keep a reference to it and
+        // search it without the manager's lock; any insert or remove makes it stale.
+        struct LookupSnapshot {
+            const AllocationRange *find(uintptr_t address) const;
+            uint64_t layoutVersion = 0;
+            std::vector<AllocationRange> ranges;
+        };
+
+        MapBasedAllocationTracker() : trackerId(++trackerIdCounter) {}
+
         void insert(SvmAllocationData);
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
         size_t getNumAllocs() const { return allocations.size(); };
+        uint64_t getTrackerId() const { return trackerId; }
+        uint64_t getLayoutVersion() const { return layoutVersion.load(std::memory_order_acquire); }
+        std::shared_ptr<const LookupSnapshot> getLookupSnapshot();
+
+        static constexpr uint32_t lookupSnapshotRebuildThreshold = 4u;
 
       protected:
         SvmAllocationContainer allocations;
+        const uint64_t trackerId;
+        std::atomic<uint64_t> layoutVersion{1u};
+        std::shared_ptr<const LookupSnapshot> lookupSnapshot;
+        uint32_t staleLookupsCount = 0u;
+
+        static std::atomic<uint64_t> trackerIdCounter;
     };
 
     struct MapOperationsTracker {
@@ -99,8 +134,24 @@ class SVMAllocsManager {
         DeviceBitfield subdeviceBitfield;
     };
 
+    // Internal allocations matching requested types, captured for given SVM allocations layout version.
+    // Command queues with indirect access enabled submit it instead of walking all allocations each time.
+    struct IndirectResidencySnapshot {
+        uint64_t layoutVersion = 0;
+        uint32_t rootDeviceIndex = 0u;
+        uint32_t requestedTypesMask = 0u;
+        ResidencyContainer allocations;
+    };
+
+    struct UsmReuseStatistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t releasedAllocations = 0u;
+        size_t pooledSize = 0u;
+    };
+
     SVMAllocsManager(MemoryManager *memoryManager);
-    MOCKABLE_VIRTUAL ~SVMAllocsManager() = default;
+    MOCKABLE_VIRTUAL ~SVMAllocsManager();
     void *createSVMAlloc(uint32_t rootDeviceIndex,
                          size_t size,
                          const SvmAllocationProperties svmProperties,
@@ -130,17 +181,71 @@ class SVMAllocsManager {
                                                     ResidencyContainer &residencyContainer,
                                                     uint32_t requestedTypesMask);
     void makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
+    std::shared_ptr<const IndirectResidencySnapshot> getIndirectResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask);
     void *createUnifiedAllocationWithDeviceStorage(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties, const UnifiedMemoryProperties &unifiedMemoryProperties);
     void freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData);
+    bool isUsmReuseEnabled() const { return usmReusePool.enabled; }
+    UsmReuseStatistics getUsmReuseStatistics();
+    void releaseUsmReusePool();
 
   protected:
+    struct UsmReuseKey {
+        bool operator<(const UsmReuseKey &other) const {
+            return std::tie(memoryType, allocationType, rootDeviceIndex, alignedSize, subdeviceBitfield, shareable) <
+                   std::tie(other.memoryType, other.allocationType, other.rootDeviceIndex, other.alignedSize, other.subdeviceBitfield, other.shareable);
+        }
+        InternalMemoryType memoryType;
+        GraphicsAllocation::AllocationType allocationType;
+        uint32_t rootDeviceIndex;
+        size_t alignedSize;
+        unsigned long subdeviceBitfield;
+        bool shareable;
+    };
+
+    struct UsmReuseEntry {
+        std::unique_ptr<SvmAllocationData> allocData;
+        void *usmPtr = nullptr;
+        std::chrono::steady_clock::time_point releaseTime;
+    };
+
+    // Device and host USM allocations freed by the application, kept by size class and
+    // memory type until they are reused, idle for idleTimeout or pushed out by maxSize.
+    struct UsmReusePool {
+        bool enabled = false;
+        size_t maxSize = 0u;
+        std::chrono::milliseconds idleTimeout{0};
+        std::multimap<UsmReuseKey, UsmReuseEntry> entries;
+        std::unordered_map<const void *, UsmReuseKey> reusableAllocations;
+        UsmReuseStatistics statistics;
+    };
+
+    void *obtainFromUsmReusePool(const UsmReuseKey &key, size_t size, const UnifiedMemoryProperties &memoryProperties, void *device);
+    void registerReusableAllocation(const void *usmPtr, const UsmReuseKey &key);
+    bool storeInUsmReusePool(void *ptr, SvmAllocationData &svmData);
+    bool trimUsmReusePool(bool releaseAll);
+    bool trimUsmReusePoolOnAllocationFailure();
+    bool isUsmAllocationInUse(SvmAllocationData &svmData);
     void *createZeroCopySvmAllocation(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties, const DeviceBitfield &deviceBitfield);
+    void collectInternalAllocations(uint32_t rootDeviceIndex, ResidencyContainer &residencyContainer, uint32_t requestedTypesMask);
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
+    struct ThreadLookupCacheEntry {
+        SvmAllocationData *find(const void *ptr);
+
+        uint64_t trackerId = 0u;
+        std::shared_ptr<const MapBasedAllocationTracker::LookupSnapshot> snapshot;
+        const MapBasedAllocationTracker::AllocationRange *lastHit = nullptr;
+    };
+    ThreadLookupCacheEntry &getThreadLookupCacheEntry();
+
+    static constexpr size_t threadLookupCacheSize = 4u;
+
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
     MemoryManager *memoryManager;
     SpinLock mtx;
+    UsmReusePool usmReusePool;
+    std::vector<std::shared_ptr<const IndirectResidencySnapshot>> indirectResidencySnapshots;
 };
 } // namespace NEO
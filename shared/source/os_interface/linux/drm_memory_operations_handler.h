@@ -25,6 +25,10 @@ class DrmMemoryOperationsHandler : public MemoryOperationsHandler {
     virtual void mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) = 0;
     virtual std::unique_lock<std::mutex> lockHandlerForExecWA() = 0;
 
+    virtual bool isPersistentResidencySupported() const { return false; }
+    virtual uint64_t getResidencyVersion() const { return 0u; }
+    virtual void getResidentAllocations(ResidencyContainer &residentAllocations) {}
+
     static std::unique_ptr<DrmMemoryOperationsHandler> create(Drm &drm, uint32_t rootDeviceIndex);
 
   protected:
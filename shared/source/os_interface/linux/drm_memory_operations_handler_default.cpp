@@ -9,7 +9,6 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
-#include <algorithm>
 
 namespace NEO {
 
@@ -18,7 +17,13 @@ DrmMemoryOperationsHandlerDefault::~DrmMemoryOperationsHandlerDefault() = defaul
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     std::lock_guard<std::mutex> lock(mutex);
-    this->residency.insert(gfxAllocations.begin(), gfxAllocations.end());
+    bool residencyChanged = false;
+    for (auto gfxAllocation : gfxAllocations) {
+        residencyChanged |= this->residency.insert(gfxAllocation).second;
+    }
+    if (residencyChanged) {
+        this->residencyVersion++;
+    }
     return MemoryOperationsStatus::SUCCESS;
 }
 
@@ -29,7 +34,9 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::makeResident(Device *d
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::evictWithinOsContext(OsContext *osContext, GraphicsAllocation &gfxAllocation) {
     std::lock_guard<std::mutex> lock(mutex);
-    this->residency.erase(&gfxAllocation);
+    if (this->residency.erase(&gfxAllocation) != 0u) {
+        this->residencyVersion++;
+    }
     return MemoryOperationsStatus::SUCCESS;
 }
 
@@ -48,10 +55,13 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::isResident(Device *dev
 }
 
 void DrmMemoryOperationsHandlerDefault::mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) {
-    for (auto gfxAllocation = this->residency.begin(); gfxAllocation != this->residency.end(); gfxAllocation++) {
-        auto ret = std::find(residencyContainer.begin(), residencyContainer.end(), *gfxAllocation);
-        if (ret == residencyContainer.end()) {
-            residencyContainer.push_back(*gfxAllocation);
+    if (this->residency.empty()) {
+        return;
+    }
+    std::unordered_set<GraphicsAllocation *> alreadyMerged(residencyContainer.begin(), residencyContainer.end());
+    for (auto gfxAllocation : this->residency) {
+        if (alreadyMerged.find(gfxAllocation) == alreadyMerged.end()) {
+            residencyContainer.push_back(gfxAllocation);
         }
     }
 }
@@ -63,4 +73,17 @@ std::unique_lock<std::mutex> DrmMemoryOperationsHandlerDefault::lockHandlerForEx
     return std::unique_lock<std::mutex>();
 }
 
+bool DrmMemoryOperationsHandlerDefault::isPersistentResidencySupported() const {
+    return DebugManager.flags.EnablePersistentDrmResidency.get() != 0;
+}
+
+uint64_t DrmMemoryOperationsHandlerDefault::getResidencyVersion() const {
+    return this->residencyVersion.load();
+}
+
+void DrmMemoryOperationsHandlerDefault::getResidentAllocations(ResidencyContainer &residentAllocations) {
+    std::lock_guard<std::mutex> lock(mutex);
+    residentAllocations.assign(this->residency.begin(), this->residency.end());
+}
+
 } // namespace NEO
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <atomic>
 #include <unordered_set>
 
 namespace NEO {
@@ -26,7 +27,12 @@ class DrmMemoryOperationsHandlerDefault : public DrmMemoryOperationsHandler {
     void mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) override;
     std::unique_lock<std::mutex> lockHandlerForExecWA() override;
 
+    bool isPersistentResidencySupported() const override;
+    uint64_t getResidencyVersion() const override;
+    void getResidentAllocations(ResidencyContainer &residentAllocations) override;
+
   protected:
     std::unordered_set<GraphicsAllocation *> residency;
+    std::atomic<uint64_t> residencyVersion{0u};
 };
 } // namespace NEO
@@ -11,15 +11,44 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
+constexpr size_t PageFaultManager::migrationChunkSize;
+
+size_t PageFaultManager::getChunkSize(const PageFaultData &pageFaultData, size_t chunkIndex) {
+    return std::min(migrationChunkSize, pageFaultData.size - chunkIndex * migrationChunkSize);
+}
+
+template <typename PredicateT, typename OperationT>
+void PageFaultManager::forEachChunkRange(const PageFaultData &pageFaultData, PredicateT isSelected, OperationT operation) {
+    auto &chunks = pageFaultData.chunks;
+    size_t first = 0;
+    while (first < chunks.size()) {
+        if (!isSelected(chunks[first])) {
+            first++;
+            continue;
+        }
+        auto last = first + 1;
+        while (last < chunks.size() && isSelected(chunks[last])) {
+            last++;
+        }
+        auto offset = first * migrationChunkSize;
+        operation(offset, std::min(last * migrationChunkSize, pageFaultData.size) - offset);
+        first = last;
+    }
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties) {
     const bool initialPlacementCpu = !memoryProperties.flags.usmInitialPlacementGpu;
     const auto domain = initialPlacementCpu ? AllocationDomain::Cpu : AllocationDomain::None;
+    const auto chunkState = initialPlacementCpu ? ChunkState::CpuWrite : ChunkState::None;
+    const auto chunksCount = (size + migrationChunkSize - 1) / migrationChunkSize;
 
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain, std::vector<ChunkState>(chunksCount, chunkState)}));
+    this->nonGpuDomainAllocs[unifiedMemoryManager].insert(ptr);
     if (!initialPlacementCpu) {
         this->setAubWritable(false, ptr, unifiedMemoryManager);
         this->protectCPUMemoryAccess(ptr, size);
@@ -31,10 +60,13 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        auto isChunkProtected = [](ChunkState state) { return state != ChunkState::CpuWrite; };
+        if (pageFaultData.domain == AllocationDomain::Gpu ||
+            std::any_of(pageFaultData.chunks.begin(), pageFaultData.chunks.end(), isChunkProtected)) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
-        this->memoryData.erase(ptr);
+        this->nonGpuDomainAllocs[pageFaultData.unifiedMemoryManager].erase(ptr);
+        this->memoryData.erase(alloc);
     }
 }
 
@@ -44,45 +76,85 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
         if (pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(ptr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-            }
-            pageFaultData.domain = AllocationDomain::Gpu;
+            this->migrateStorageToGpuDomain(ptr, pageFaultData);
         }
+        this->nonGpuDomainAllocs[pageFaultData.unifiedMemoryManager].erase(ptr);
     }
 }
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(allocPtr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
-            }
-            pageFaultData.domain = AllocationDomain::Gpu;
+    auto allocs = this->nonGpuDomainAllocs.find(unifiedMemoryManager);
+    if (allocs == this->nonGpuDomainAllocs.end()) {
+        return;
+    }
+    for (auto allocPtr : allocs->second) {
+        auto &pageFaultData = this->memoryData.at(allocPtr);
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
+            this->migrateStorageToGpuDomain(allocPtr, pageFaultData);
         }
     }
+    allocs->second.clear();
+}
+
+void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.domain == AllocationDomain::Cpu) {
+        auto isChunkWritten = [](ChunkState state) { return state == ChunkState::CpuWrite; };
+        auto isChunkAccessible = [](ChunkState state) { return state == ChunkState::CpuWrite || state == ChunkState::CpuRead; };
+
+        forEachChunkRange(pageFaultData, isChunkWritten, [&](size_t offset, size_t size) {
+            this->transferToGpu(ptr, offset, size, pageFaultData.cmdQ);
+        });
+        forEachChunkRange(pageFaultData, isChunkAccessible, [&](size_t offset, size_t size) {
+            this->protectCPUMemoryAccess(ptrOffset(ptr, offset), size);
+        });
+    }
+    std::fill(pageFaultData.chunks.begin(), pageFaultData.chunks.end(), ChunkState::Gpu);
+    pageFaultData.domain = AllocationDomain::Gpu;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->broadcastWaitSignal();
-            this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc != this->memoryData.begin()) {
+        --alloc;
+        auto allocPtr = alloc->first;
+        auto &pageFaultData = alloc->second;
+        if (ptr < ptrOffset(allocPtr, pageFaultData.size)) {
+            auto chunkIndex = ptrDiff(ptr, allocPtr) / migrationChunkSize;
+            auto chunkOffset = chunkIndex * migrationChunkSize;
+            auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+            auto chunkSize = getChunkSize(pageFaultData, chunkIndex);
+            auto &chunkState = pageFaultData.chunks[chunkIndex];
+
+            auto otherThreadsStopped = this->broadcastWaitSignal();
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Gpu) {
-                this->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
+            switch (chunkState) {
+            case ChunkState::Gpu:
+                this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+                this->transferToCpu(allocPtr, chunkOffset, chunkSize, pageFaultData.cmdQ);
+                if (otherThreadsStopped) {
+                    // nobody else could write chunk while it was writable, map it read only, a write faults again and marks it for copy back
+                    this->protectCPUMemoryFromWrites(chunkPtr, chunkSize);
+                    chunkState = ChunkState::CpuRead;
+                } else {
+                    // other threads may have written chunk unnoticed while it was writable, so it must be copied back
+                    chunkState = ChunkState::CpuWrite;
+                }
+                break;
+            case ChunkState::None:
+                // nothing to copy, first access maps chunk read only, a write faults again and marks it for copy back
+                this->protectCPUMemoryFromWrites(chunkPtr, chunkSize);
+                chunkState = ChunkState::CpuRead;
+                break;
+            default:
+                this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+                chunkState = ChunkState::CpuWrite;
+                break;
             }
             pageFaultData.domain = AllocationDomain::Cpu;
+            this->nonGpuDomainAllocs[pageFaultData.unifiedMemoryManager].insert(allocPtr);
             return true;
         }
     }
@@ -7,13 +7,17 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -37,27 +41,48 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         Gpu,
     };
 
+    // allocations migrate in chunks, only chunks touched by the CPU are copied
+    static constexpr size_t migrationChunkSize = MemoryConstants::pageSize64k;
+
+    enum class ChunkState : uint8_t {
+        None,     // protected, contents undefined in both domains
+        Gpu,      // protected, contents valid only on GPU
+        CpuRead,  // read only, contents valid in both domains
+        CpuWrite, // accessible, contents valid only on CPU
+    };
+
   protected:
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        std::vector<ChunkState> chunks;
     };
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void protectCPUMemoryFromWrites(void *ptr, size_t size) = 0;
 
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
-    virtual void broadcastWaitSignal() = 0;
+    // returns true when all other threads are stopped on mtx until the fault is handled
+    virtual bool broadcastWaitSignal() = 0;
     MOCKABLE_VIRTUAL void waitForCopy();
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
-    MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
-    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t offset, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    static size_t getChunkSize(const PageFaultData &pageFaultData, size_t chunkIndex);
+    template <typename PredicateT, typename OperationT>
+    static void forEachChunkRange(const PageFaultData &pageFaultData, PredicateT isSelected, OperationT operation);
+
+    // ordered by address, fault handler looks up allocation containing faulting address
+    std::map<void *, PageFaultData> memoryData;
+    // allocations not in GPU domain, per unified memory manager
+    std::unordered_map<SVMAllocsManager *, std::unordered_set<void *>> nonGpuDomainAllocs;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -12,13 +12,17 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 
+#include <chrono>
 #include <dirent.h>
 #include <sys/mman.h>
 #include <sys/syscall.h>
 #include <sys/types.h>
+#include <thread>
 #include <unistd.h>
 
 namespace NEO {
+constexpr int64_t PageFaultManagerLinux::maxWaitForSignaledThreadsTimeUs;
+
 std::unique_ptr<PageFaultManager> PageFaultManager::create() {
     return std::make_unique<PageFaultManagerLinux>();
 }
@@ -28,7 +32,9 @@ std::function<void(int signal, siginfo_t *info, void *context)> PageFaultManager
 PageFaultManagerLinux::PageFaultManagerLinux() {
     pageFaultHandler = [&](int signal, siginfo_t *info, void *context) {
         if (signal == SIGUSR1) {
+            this->waitingThreadsCount++;
             this->waitForCopy();
+            this->waitingThreadsCount--;
         } else if (!this->verifyPageFault(info->si_addr)) {
             callPreviousHandler(signal, info, context);
         }
@@ -72,6 +78,11 @@ void PageFaultManagerLinux::protectCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+void PageFaultManagerLinux::protectCPUMemoryFromWrites(void *ptr, size_t size) {
+    auto retVal = mprotect(ptr, size, PROT_READ);
+    UNRECOVERABLE_IF(retVal != 0);
+}
+
 void PageFaultManagerLinux::callPreviousHandler(int signal, siginfo_t *info, void *context) {
     if (previousPageFaultHandler.sa_flags & SA_SIGINFO) {
         previousPageFaultHandler.sa_sigaction(signal, info, context);
@@ -92,8 +103,9 @@ void PageFaultManagerLinux::callPreviousHandler(int signal, siginfo_t *info, voi
    While handling page fault, before copy starts, user signal (SIGUSR1)
    is broadcasted to ensure that every thread received signal and is
    stucked on PageFaultHandler's mutex before copy from GPU to CPU proceeds. */
-void PageFaultManagerLinux::broadcastWaitSignal() {
+bool PageFaultManagerLinux::broadcastWaitSignal() {
     auto selfThreadId = syscall(__NR_gettid);
+    uint32_t signaledThreadsCount = 0u;
 
     auto procDir = opendir("/proc/self/task");
     UNRECOVERABLE_IF(!procDir);
@@ -109,14 +121,35 @@ void PageFaultManagerLinux::broadcastWaitSignal() {
             continue;
         }
 
-        sendSignalToThread(threadId);
+        if (sendSignalToThread(threadId)) {
+            signaledThreadsCount++;
+        }
     }
 
     closedir(procDir);
+
+    return waitForSignaledThreads(signaledThreadsCount);
 }
 
-void PageFaultManagerLinux::sendSignalToThread(int threadId) {
-    syscall(SYS_tkill, threadId, SIGUSR1);
+bool PageFaultManagerLinux::sendSignalToThread(int threadId) {
+    return syscall(SYS_tkill, threadId, SIGUSR1) == 0;
+}
+
+bool PageFaultManagerLinux::waitForSignaledThreads(uint32_t signaledThreadsCount) {
+    if (!waitForSignaledThreadsEnabled) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    while (this->waitingThreadsCount < signaledThreadsCount) {
+        auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        if (elapsedUs > maxWaitForSignaledThreadsTimeUs) {
+            waitForSignaledThreadsEnabled = false;
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
 }
 
 void PageFaultManagerLinux::evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) {
@@ -9,6 +9,7 @@
 
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include <atomic>
 #include <csignal>
 #include <functional>
 
@@ -23,10 +24,12 @@ class PageFaultManagerLinux : public PageFaultManager {
   protected:
     void allowCPUMemoryAccess(void *ptr, size_t size) override;
     void protectCPUMemoryAccess(void *ptr, size_t size) override;
+    void protectCPUMemoryFromWrites(void *ptr, size_t size) override;
 
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override;
-    void broadcastWaitSignal() override;
-    MOCKABLE_VIRTUAL void sendSignalToThread(int threadId);
+    bool broadcastWaitSignal() override;
+    MOCKABLE_VIRTUAL bool sendSignalToThread(int threadId);
+    bool waitForSignaledThreads(uint32_t signaledThreadsCount);
 
     void callPreviousHandler(int signal, siginfo_t *info, void *context);
     bool previousHandlerRestored = false;
@@ -37,5 +40,11 @@ class PageFaultManagerLinux : public PageFaultManager {
     struct sigaction previousUserSignalHandler = {};
 
     bool evictMemoryAfterCopy = false;
+
+    static constexpr int64_t maxWaitForSignaledThreadsTimeUs = 100000;
+    // threads inside user signal handler, stopped on mtx, count also those still stopped since previous fault
+    std::atomic<uint32_t> waitingThreadsCount{0};
+    // disabled after signaled thread didn't respond in time, e.g. because it blocks user signal
+    bool waitForSignaledThreadsEnabled = true;
 };
 } // namespace NEO
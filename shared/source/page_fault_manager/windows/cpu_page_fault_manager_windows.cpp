@@ -51,8 +51,14 @@ void PageFaultManagerWindows::protectCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(!retVal);
 }
 
+void PageFaultManagerWindows::protectCPUMemoryFromWrites(void *ptr, size_t size) {
+    DWORD previousState;
+    auto retVal = VirtualProtect(ptr, size, PAGE_READONLY, &previousState);
+    UNRECOVERABLE_IF(!retVal);
+}
+
 void PageFaultManagerWindows::evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) {}
 
-void PageFaultManagerWindows::broadcastWaitSignal() {}
+bool PageFaultManagerWindows::broadcastWaitSignal() { return false; }
 
 } // namespace NEO
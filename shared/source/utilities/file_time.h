@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <ctime>
+#include <string>
+
+namespace NEO {
+// sets modification time of an existing file, returns false on failure
+bool setFileModificationTime(const std::string &path, time_t modificationTime);
+} // namespace NEO
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/file_time.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+namespace NEO {
+
+bool setFileModificationTime(const std::string &path, time_t modificationTime) {
+    struct timespec times[2] = {};
+    times[0].tv_nsec = UTIME_OMIT;
+    times[1].tv_sec = modificationTime;
+    return 0 == utimensat(AT_FDCWD, path.c_str(), times, 0);
+}
+} // namespace NEO
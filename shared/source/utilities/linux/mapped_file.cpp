@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::openReadOnly(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    struct stat fileStat = {};
+    if ((0 == fstat(fd, &fileStat)) && (fileStat.st_size > 0)) {
+        auto fileSize = static_cast<size_t>(fileStat.st_size);
+        void *address = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            mappedFile.reset(new MappedFile());
+            mappedFile->address = address;
+            mappedFile->size = fileSize;
+        }
+    }
+
+    // mapping stays valid after the descriptor is closed
+    close(fd);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (address != nullptr) {
+        munmap(address, size);
+    }
+}
+} // namespace NEO
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+class MappedFile {
+  public:
+    static std::unique_ptr<MappedFile> openReadOnly(const std::string &path);
+
+    virtual ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ArrayRef<const uint8_t> getData() const {
+        return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(address), size);
+    }
+
+  protected:
+    MappedFile() = default;
+
+    void *address = nullptr;
+    size_t size = 0u;
+    void *osHandle = nullptr;
+};
+} // namespace NEO
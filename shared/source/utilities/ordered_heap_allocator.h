@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace NEO {
+
+// Same two-ended layout and placement rules as HeapAllocator, but freed chunks are kept
+// in address- and size-ordered trees: best fit is a lower_bound lookup and neighbouring
+// chunks are coalesced on free, so allocation never falls back to a full defragmentation.
+class OrderedHeapAllocator {
+  public:
+    OrderedHeapAllocator(uint64_t address, uint64_t size) : OrderedHeapAllocator(address, size, 4 * MemoryConstants::megaByte) {
+    }
+
+    OrderedHeapAllocator(uint64_t address, uint64_t size, size_t threshold) : size(size), availableSize(size), sizeThreshold(threshold) {
+        pLeftBound = address;
+        pRightBound = address + size;
+    }
+
+    uint64_t allocate(size_t &sizeToAllocate) {
+        sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+        if (availableSize < sizeToAllocate) {
+            return 0llu;
+        }
+
+        FreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+        size_t sizeOfFreedChunk = 0;
+        uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk);
+
+        if (ptrReturn == 0llu) {
+            if (sizeToAllocate > sizeThreshold) {
+                if (pLeftBound + sizeToAllocate <= pRightBound) {
+                    ptrReturn = pLeftBound;
+                    pLeftBound += sizeToAllocate;
+                }
+            } else {
+                if (pRightBound - sizeToAllocate >= pLeftBound) {
+                    pRightBound -= sizeToAllocate;
+                    ptrReturn = pRightBound;
+                }
+            }
+        }
+
+        if (ptrReturn == 0llu) {
+            return 0llu;
+        }
+
+        if (sizeOfFreedChunk > 0) {
+            sizeToAllocate = sizeOfFreedChunk;
+        }
+        availableSize -= sizeToAllocate;
+        return ptrReturn;
+    }
+
+    void free(uint64_t ptr, size_t size) {
+        if (ptr == 0llu)
+            return;
+
+        std::lock_guard<std::mutex> lock(mtx);
+        DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+
+        if (ptr == pRightBound) {
+            pRightBound = ptr + size;
+            mergeFreedSmallWithBound();
+        } else if (ptr == pLeftBound - size) {
+            pLeftBound = ptr;
+            mergeFreedBigWithBound();
+        } else if (ptr < pLeftBound) {
+            storeInFreedChunks(ptr, size, freedChunksBig);
+        } else {
+            storeInFreedChunks(ptr, size, freedChunksSmall);
+        }
+        availableSize += size;
+    }
+
+    uint64_t getLeftSize() const {
+        return availableSize;
+    }
+
+    uint64_t getUsedSize() const {
+        return size - availableSize;
+    }
+
+    NO_SANITIZE
+    double getUsage() const {
+        return static_cast<double>(size - availableSize) / size;
+    }
+
+  protected:
+    struct FreedChunks {
+        std::map<uint64_t, size_t> byAddress;
+        std::set<std::pair<size_t, uint64_t>> bySize;
+
+        void insert(uint64_t ptr, size_t size) {
+            byAddress.emplace(ptr, size);
+            bySize.emplace(size, ptr);
+        }
+
+        void erase(std::map<uint64_t, size_t>::iterator chunk) {
+            bySize.erase({chunk->second, chunk->first});
+            byAddress.erase(chunk);
+        }
+    };
+
+    const uint64_t size;
+    uint64_t availableSize;
+    uint64_t pLeftBound;
+    uint64_t pRightBound;
+    const size_t sizeThreshold;
+    size_t allocationAlignment = MemoryConstants::pageSize;
+
+    FreedChunks freedChunksSmall;
+    FreedChunks freedChunksBig;
+    std::mutex mtx;
+
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks, size_t &sizeOfFreedChunk) {
+        sizeOfFreedChunk = 0;
+
+        auto bestFit = freedChunks.bySize.lower_bound({size, 0llu});
+        if (bestFit == freedChunks.bySize.end()) {
+            return 0llu;
+        }
+
+        auto bestFitSize = bestFit->first;
+        auto bestFitPtr = bestFit->second;
+        freedChunks.bySize.erase(bestFit);
+
+        if (bestFitSize < (size << 1)) {
+            freedChunks.byAddress.erase(bestFitPtr);
+            if (bestFitSize != size) {
+                sizeOfFreedChunk = bestFitSize;
+            }
+            return bestFitPtr;
+        }
+
+        size_t sizeDelta = bestFitSize - size;
+        freedChunks.byAddress[bestFitPtr] = sizeDelta;
+        freedChunks.bySize.emplace(sizeDelta, bestFitPtr);
+        return bestFitPtr + sizeDelta;
+    }
+
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) {
+        auto next = freedChunks.byAddress.lower_bound(ptr);
+        if (next != freedChunks.byAddress.begin()) {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second == ptr) {
+                ptr = previous->first;
+                size += previous->second;
+                freedChunks.erase(previous);
+            }
+        }
+        if (next != freedChunks.byAddress.end() && next->first == ptr + size) {
+            size += next->second;
+            freedChunks.erase(next);
+        }
+        freedChunks.insert(ptr, size);
+    }
+
+    void mergeFreedSmallWithBound() {
+        auto chunk = freedChunksSmall.byAddress.find(pRightBound);
+        if (chunk != freedChunksSmall.byAddress.end()) {
+            pRightBound += chunk->second;
+            freedChunksSmall.erase(chunk);
+        }
+    }
+
+    void mergeFreedBigWithBound() {
+        auto chunk = freedChunksBig.byAddress.lower_bound(pLeftBound);
+        if (chunk != freedChunksBig.byAddress.begin()) {
+            --chunk;
+            if (chunk->first + chunk->second == pLeftBound) {
+                pLeftBound = chunk->first;
+                freedChunksBig.erase(chunk);
+            }
+        }
+    }
+};
+} // namespace NEO
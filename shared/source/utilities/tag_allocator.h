@@ -14,6 +14,7 @@
 #include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace NEO {
@@ -74,13 +75,20 @@ class TagAllocator {
   public:
     using NodeType = TagNode<TagType>;
 
+    static constexpr size_t maxMagazinesCount = 64;
+    static constexpr size_t threadMagazineCacheSize = 4;
+
     TagAllocator(uint32_t rootDeviceIndex, MemoryManager *memMngr, size_t tagCount,
                  size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes,
-                 DeviceBitfield deviceBitfield) : deviceBitfield(deviceBitfield),
-                                                  rootDeviceIndex(rootDeviceIndex),
-                                                  memoryManager(memMngr),
-                                                  tagCount(tagCount),
-                                                  doNotReleaseNodes(doNotReleaseNodes) {
+                 DeviceBitfield deviceBitfield, size_t magazineSize = 0,
+                 bool trackUsedTags = true) : deviceBitfield(deviceBitfield),
+                                              rootDeviceIndex(rootDeviceIndex),
+                                              memoryManager(memMngr),
+                                              tagCount(tagCount),
+                                              magazineSize(magazineSize),
+                                              allocatorId(++allocatorIdCounter),
+                                              doNotReleaseNodes(doNotReleaseNodes),
+                                              trackUsedTags(trackUsedTags) {
 
         this->tagSize = alignUp(tagSize, tagAlignment);
         populateFreeTags();
@@ -98,16 +106,20 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
+        NodeType *node = nullptr;
+        auto magazine = getThreadMagazine();
+        if (magazine) {
+            if (magazine->nodes.empty()) {
+                refillMagazine(*magazine);
+            }
+            node = magazine->nodes.back();
+            magazine->nodes.pop_back();
+        } else {
+            node = getTagFromFreeTags();
         }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
-            std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
-            node = freeTags.removeFrontOne().release();
+        if (trackUsedTags) {
+            usedTags.pushFrontOne(*node);
         }
-        usedTags.pushFrontOne(*node);
         node->incRefCount();
         node->initialize();
         return node;
@@ -124,32 +136,148 @@ class TagAllocator {
     }
 
   protected:
+    struct TagMagazine {
+        std::thread::id ownerThread;
+        std::vector<NodeType *> nodes;
+    };
+
+    struct ThreadMagazineCacheEntry {
+        uint64_t allocatorId;
+        TagMagazine *magazine;
+    };
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
+    std::vector<std::unique_ptr<TagMagazine>> magazines;
 
     const DeviceBitfield deviceBitfield;
     const uint32_t rootDeviceIndex;
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagSize;
+    const size_t magazineSize;
+    const uint64_t allocatorId;
     bool doNotReleaseNodes = false;
+    const bool trackUsedTags;
 
     std::mutex allocatorMutex;
 
+    static std::atomic<uint64_t> allocatorIdCounter;
+
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        UNUSED_VARIABLE(usedNode);
+        removeFromUsedTags(node);
+        auto magazine = getThreadMagazine();
+        if (magazine) {
+            if (magazine->nodes.size() >= magazineSize) {
+                flushMagazine(*magazine);
+            }
+            magazine->nodes.push_back(node);
+            return;
+        }
         freeTags.pushFrontOne(*node);
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        removeFromUsedTags(node);
+        deferredTags.pushFrontOne(*node);
+    }
+
+    void removeFromUsedTags(NodeType *node) {
+        if (trackUsedTags) {
+            NodeType *usedNode = usedTags.removeOne(*node).release();
+            DEBUG_BREAK_IF(usedNode == nullptr);
+            UNUSED_VARIABLE(usedNode);
+        }
+    }
+
+    NodeType *getTagFromFreeTags() {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        NodeType *node = freeTags.removeFrontOne().release();
+        if (!node) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            populateFreeTags();
+            node = freeTags.removeFrontOne().release();
+        }
+        return node;
+    }
+
+    // Free tags cached by the calling thread. The lookup goes through a small thread-local
+    // cache, so getTag/returnTag don't touch shared state until the magazine has to be
+    // refilled from or flushed to freeTags, which is done in batches of magazineSize / 2.
+    // Threads that didn't get a magazine because all maxMagazinesCount were taken cache
+    // a null entry, so they go straight to freeTags without scanning magazines again.
+    TagMagazine *getThreadMagazine() {
+        if (magazineSize == 0) {
+            return nullptr;
+        }
+
+        thread_local ThreadMagazineCacheEntry threadMagazineCache[threadMagazineCacheSize] = {};
+        thread_local size_t nextCacheEntry = 0;
+
+        for (auto &entry : threadMagazineCache) {
+            if (entry.allocatorId == allocatorId) {
+                return entry.magazine;
+            }
+        }
+
+        TagMagazine *magazine = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            auto currentThread = std::this_thread::get_id();
+            for (auto &threadMagazine : magazines) {
+                if (threadMagazine->ownerThread == currentThread) {
+                    magazine = threadMagazine.get();
+                    break;
+                }
+            }
+            if (magazine == nullptr) {
+                if (magazines.size() < maxMagazinesCount) {
+                    auto newMagazine = std::make_unique<TagMagazine>();
+                    newMagazine->ownerThread = currentThread;
+                    newMagazine->nodes.reserve(magazineSize);
+                    magazine = newMagazine.get();
+                    magazines.push_back(std::move(newMagazine));
+                }
+            }
+        }
+
+        threadMagazineCache[nextCacheEntry] = {allocatorId, magazine};
+        nextCacheEntry = (nextCacheEntry + 1) % threadMagazineCacheSize;
+        return magazine;
+    }
+
+    void refillMagazine(TagMagazine &magazine) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        if (freeTags.peekIsEmpty()) {
+            populateFreeTags();
+        }
+
+        auto refillCount = std::max(magazineSize / 2, static_cast<size_t>(1u));
+        while (magazine.nodes.size() < refillCount) {
+            NodeType *node = freeTags.removeFrontOne().release();
+            if (node == nullptr) {
+                break;
+            }
+            magazine.nodes.push_back(node);
+        }
+        // nodes are taken from the back, keep the freeTags order
+        std::reverse(magazine.nodes.begin(), magazine.nodes.end());
+    }
+
+    void flushMagazine(TagMagazine &magazine) {
+        auto flushCount = std::max(magazine.nodes.size() / 2, static_cast<size_t>(1u));
+        for (size_t i = 0; i < flushCount; i++) {
+            freeTags.pushFrontOne(*magazine.nodes[i]);
+        }
+        magazine.nodes.erase(magazine.nodes.begin(), magazine.nodes.begin() + flushCount);
     }
 
     void populateFreeTags() {
@@ -200,4 +328,7 @@ class TagAllocator {
         }
     }
 };
+
+template <typename TagType>
+std::atomic<uint64_t> TagAllocator<TagType>::allocatorIdCounter{0};
 } // namespace NEO
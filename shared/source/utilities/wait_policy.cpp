@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/wait_policy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+namespace NEO {
+
+constexpr int64_t WaitPolicy::defaultSpinTimeUs;
+constexpr uint32_t WaitPolicy::maxPausesPerCheck;
+constexpr size_t WaitPolicy::histogramBucketCount;
+
+WaitPolicy::WaitPolicy() {
+    if (DebugManager.flags.WaitPolicySpinTimeUs.get() != -1) {
+        spinTimeUs = DebugManager.flags.WaitPolicySpinTimeUs.get();
+    }
+    if (DebugManager.flags.EnableWaitPolicyBlockingWait.get() != -1) {
+        blockingWaitEnabled = !!DebugManager.flags.EnableWaitPolicyBlockingWait.get();
+    }
+    printHistogramsOnDestruction = DebugManager.flags.PrintWaitPolicyHistograms.get();
+
+    for (auto &histogram : histograms) {
+        for (auto &bucket : histogram) {
+            bucket = 0u;
+        }
+    }
+}
+
+WaitPolicy::~WaitPolicy() {
+    if (printHistogramsOnDestruction) {
+        printHistograms(stdout);
+    }
+}
+
+size_t WaitPolicy::getHistogramBucket(int64_t waitTimeUs) {
+    size_t bucket = 0u;
+    while (waitTimeUs > 0 && bucket < histogramBucketCount - 1) {
+        waitTimeUs >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+uint64_t WaitPolicy::getWaitCount(WaitPhase phase) const {
+    uint64_t count = 0u;
+    for (auto &bucket : histograms[static_cast<uint32_t>(phase)]) {
+        count += bucket;
+    }
+    return count;
+}
+
+void WaitPolicy::printHistograms(FILE *stream) const {
+    const char *phaseNames[] = {"spin", "block", "yield", "timeout"};
+    fprintf(stream, "Wait histograms (spin window %lld us), bucket upper bound in us:\n", static_cast<long long>(spinTimeUs));
+    for (uint32_t phase = 0; phase < static_cast<uint32_t>(WaitPhase::Count); phase++) {
+        if (getWaitCount(static_cast<WaitPhase>(phase)) == 0u) {
+            continue;
+        }
+        fprintf(stream, "%8s:", phaseNames[phase]);
+        for (size_t bucket = 0; bucket < histogramBucketCount; bucket++) {
+            uint64_t count = histograms[phase][bucket];
+            if (count) {
+                fprintf(stream, " <%llu:%llu", 1ull << bucket, static_cast<unsigned long long>(count));
+            }
+        }
+        fprintf(stream, "\n");
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+namespace NEO {
+
+// Waits in three phases: spin with exponential pause backoff for a short window,
+// then a single blocking OS wait (only for waits without timeout that know their OS wait), then poll with yield.
+// Waits completed at the first check are not recorded in histograms, so the fast path touches no shared state.
+class WaitPolicy : NonCopyableOrMovableClass {
+  public:
+    enum class WaitPhase : uint32_t {
+        Spin = 0,
+        Block,
+        Yield,
+        Timeout,
+        Count
+    };
+
+    static constexpr int64_t defaultSpinTimeUs = 50;
+    static constexpr uint32_t maxPausesPerCheck = 64u;
+    static constexpr size_t histogramBucketCount = 24u;
+
+    WaitPolicy();
+    ~WaitPolicy();
+
+    template <typename IsCompletedT, typename BlockingWaitT>
+    bool wait(IsCompletedT &&isCompleted, BlockingWaitT &&blockingWait, bool enableTimeout, int64_t timeoutMicroseconds) {
+        return waitImpl(isCompleted, blockingWait, true, enableTimeout, timeoutMicroseconds);
+    }
+
+    // no OS wait covering the awaited work is known, spin then poll
+    template <typename IsCompletedT>
+    bool wait(IsCompletedT &&isCompleted, bool enableTimeout, int64_t timeoutMicroseconds) {
+        return waitImpl(isCompleted, []() {}, false, enableTimeout, timeoutMicroseconds);
+    }
+
+    int64_t getSpinTimeUs() const { return spinTimeUs; }
+    bool isBlockingWaitEnabled() const { return blockingWaitEnabled; }
+    uint64_t getHistogramCount(WaitPhase phase, size_t bucket) const { return histograms[static_cast<uint32_t>(phase)][bucket]; }
+    uint64_t getWaitCount(WaitPhase phase) const;
+    static size_t getHistogramBucket(int64_t waitTimeUs);
+    void printHistograms(FILE *stream) const;
+
+  protected:
+    template <typename IsCompletedT, typename BlockingWaitT>
+    bool waitImpl(IsCompletedT &isCompleted, BlockingWaitT &&blockingWait, bool canBlock, bool enableTimeout, int64_t timeoutMicroseconds);
+
+    static int64_t getElapsedUs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    void recordWait(WaitPhase phase, int64_t waitTimeUs) {
+        histograms[static_cast<uint32_t>(phase)][getHistogramBucket(waitTimeUs)].fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    int64_t spinTimeUs = defaultSpinTimeUs;
+    bool blockingWaitEnabled = true;
+    bool printHistogramsOnDestruction = false;
+    std::atomic<uint64_t> histograms[static_cast<uint32_t>(WaitPhase::Count)][histogramBucketCount];
+};
+
+template <typename IsCompletedT, typename BlockingWaitT>
+bool WaitPolicy::waitImpl(IsCompletedT &isCompleted, BlockingWaitT &&blockingWait, bool canBlock, bool enableTimeout, int64_t timeoutMicroseconds) {
+    if (isCompleted()) {
+        return true;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto spinLimitUs = enableTimeout ? std::min(spinTimeUs, timeoutMicroseconds) : spinTimeUs;
+    int64_t elapsedUs = 0;
+    uint32_t pauses = 1u;
+    do {
+        for (uint32_t i = 0; i < pauses; i++) {
+            CpuIntrinsics::pause();
+        }
+        if (isCompleted()) {
+            recordWait(WaitPhase::Spin, getElapsedUs(start));
+            return true;
+        }
+        pauses = std::min(pauses * 2, maxPausesPerCheck);
+        elapsedUs = getElapsedUs(start);
+    } while (elapsedUs < spinLimitUs);
+
+    if (canBlock && blockingWaitEnabled && !enableTimeout) {
+        blockingWait();
+        if (isCompleted()) {
+            recordWait(WaitPhase::Block, getElapsedUs(start));
+            return true;
+        }
+    }
+
+    while (!enableTimeout || elapsedUs <= timeoutMicroseconds) {
+        std::this_thread::yield();
+        CpuIntrinsics::pause();
+        if (isCompleted()) {
+            recordWait(WaitPhase::Yield, getElapsedUs(start));
+            return true;
+        }
+        if (enableTimeout) {
+            elapsedUs = getElapsedUs(start);
+        }
+    }
+
+    recordWait(WaitPhase::Timeout, elapsedUs);
+    return false;
+}
+
+} // namespace NEO
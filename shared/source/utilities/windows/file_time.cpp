@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/file_time.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+bool setFileModificationTime(const std::string &path, time_t modificationTime) {
+    HANDLE file = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // FILETIME counts 100ns intervals since 1601-01-01
+    ULARGE_INTEGER fileTimeValue = {};
+    fileTimeValue.QuadPart = static_cast<ULONGLONG>(modificationTime) * 10000000ull + 116444736000000000ull;
+    FILETIME fileTime = {};
+    fileTime.dwLowDateTime = fileTimeValue.LowPart;
+    fileTime.dwHighDateTime = fileTimeValue.HighPart;
+
+    auto updated = (FALSE != SetFileTime(file, nullptr, nullptr, &fileTime));
+    CloseHandle(file);
+    return updated;
+}
+} // namespace NEO
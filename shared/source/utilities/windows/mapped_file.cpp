@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::openReadOnly(const std::string &path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    LARGE_INTEGER fileSize = {};
+    if (GetFileSizeEx(file, &fileSize) && (fileSize.QuadPart > 0)) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            void *address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (address != nullptr) {
+                mappedFile.reset(new MappedFile());
+                mappedFile->address = address;
+                mappedFile->size = static_cast<size_t>(fileSize.QuadPart);
+                mappedFile->osHandle = mapping;
+            } else {
+                CloseHandle(mapping);
+            }
+        }
+    }
+
+    // view stays valid after the file handle is closed
+    CloseHandle(file);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (address != nullptr) {
+        UnmapViewOfFile(address);
+    }
+    if (osHandle != nullptr) {
+        CloseHandle(osHandle);
+    }
+}
+} // namespace NEO
@@ -6,11 +6,17 @@
  */
 
 #include "shared/source/command_container/cmdcontainer.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/test/unit_test/fixtures/device_fixture.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
+#include <chrono>
+#include <iostream>
+
 using namespace NEO;
 
 class CommandContainerTest : public DeviceFixture,
@@ -520,3 +526,160 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenDestructionThenNonHeapAllo
     cmdContainer.reset();
     EXPECT_EQ(alloc.getUnderlyingBufferSize(), size);
 }
+
+TEST_F(CommandContainerTest, givenRecordedCommandsWhenContinuingAfterSubmissionThenSubmissionStartIsSetAfterRecordedCommandsAndResidencyIsRebuilt) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    cmdContainer.allocateNextCommandBuffer();
+    cmdContainer.getCommandStream()->getSpace(0x100);
+    MockGraphicsAllocation alloc;
+    cmdContainer.addToResidencyContainer(&alloc);
+    cmdContainer.setDirtyStateForAllHeaps(false);
+
+    cmdContainer.continueAfterSubmission();
+
+    EXPECT_EQ(1u, cmdContainer.getSubmissionStartCmdBufferIndex());
+    EXPECT_EQ(0x100u, cmdContainer.getSubmissionStartOffset());
+    EXPECT_EQ(0x100u, cmdContainer.getCommandStream()->getUsed());
+    EXPECT_TRUE(cmdContainer.isAnyHeapDirty());
+
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    EXPECT_EQ(1u + HeapType::NUM_TYPES, residencyContainer.size());
+    EXPECT_EQ(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), &alloc));
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), cmdContainer.getCmdBufferAllocations()[1]));
+
+    cmdContainer.reset();
+
+    EXPECT_EQ(0u, cmdContainer.getSubmissionStartCmdBufferIndex());
+    EXPECT_EQ(0u, cmdContainer.getSubmissionStartOffset());
+    EXPECT_EQ(cmdContainer.getCmdBufferAllocations()[0], cmdContainer.getCommandStream()->getGraphicsAllocation());
+}
+
+TEST_F(CommandContainerTest, givenGrownHeapWhenResettingCommandContainerThenPreviousHeapAllocationIsStoredForReuse) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    auto heap = cmdContainer.getIndirectHeap(HeapType::DYNAMIC_STATE);
+    auto oldAllocation = heap->getGraphicsAllocation();
+    auto &allocationsForReuse = pDevice->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage()->getAllocationsForReuse();
+
+    heap->getSpace(heap->getAvailableSpace() - 16);
+    cmdContainer.getHeapWithRequiredSizeAndAlignment(HeapType::DYNAMIC_STATE, 32, 32);
+    ASSERT_EQ(1u, cmdContainer.getDeallocationContainer().size());
+    EXPECT_EQ(oldAllocation, cmdContainer.getDeallocationContainer()[0]);
+
+    cmdContainer.reset();
+
+    EXPECT_TRUE(cmdContainer.getDeallocationContainer().empty());
+    EXPECT_TRUE(allocationsForReuse.peekContains(*oldAllocation));
+}
+
+TEST_F(CommandContainerTest, givenAdditionalCmdBuffersWhenResettingCommandContainerThenCmdBuffersAreStoredForReuse) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    auto &allocationsForReuse = pDevice->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage()->getAllocationsForReuse();
+
+    cmdContainer.allocateNextCommandBuffer();
+    cmdContainer.allocateNextCommandBuffer();
+    auto secondCmdBuffer = cmdContainer.getCmdBufferAllocations()[1];
+    auto thirdCmdBuffer = cmdContainer.getCmdBufferAllocations()[2];
+
+    cmdContainer.reset();
+
+    EXPECT_EQ(1u, cmdContainer.getCmdBufferAllocations().size());
+    EXPECT_TRUE(allocationsForReuse.peekContains(*secondCmdBuffer));
+    EXPECT_TRUE(allocationsForReuse.peekContains(*thirdCmdBuffer));
+}
+
+TEST_F(CommandContainerTest, givenCompletedCmdBufferStoredForReuseWhenAllocatingNextCmdBufferInAnotherContainerThenStoredCmdBufferIsReused) {
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+    auto cmdContainer = std::make_unique<CommandContainer>();
+    cmdContainer->initialize(pDevice);
+    cmdContainer->allocateNextCommandBuffer();
+    auto cmdBuffer = cmdContainer->getCmdBufferAllocations()[1];
+    cmdContainer->reset();
+    *csr->getTagAddress() = csr->peekTaskCount();
+
+    CommandContainer otherCmdContainer;
+    otherCmdContainer.initialize(pDevice);
+    otherCmdContainer.allocateNextCommandBuffer();
+
+    EXPECT_EQ(cmdBuffer, otherCmdContainer.getCmdBufferAllocations()[1]);
+    EXPECT_EQ(cmdBuffer, otherCmdContainer.getCommandStream()->getGraphicsAllocation());
+    EXPECT_EQ(CommandContainer::defaultListCmdBufferSize, otherCmdContainer.getCommandStream()->getMaxAvailableSpace());
+}
+
+TEST_F(CommandContainerTest, givenNotCompletedCmdBufferStoredForReuseWhenAllocatingNextCmdBufferThenNewCmdBufferIsAllocated) {
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    cmdContainer.allocateNextCommandBuffer();
+    auto cmdBuffer = cmdContainer.getCmdBufferAllocations()[1];
+    cmdContainer.reset();
+    *csr->getTagAddress() = csr->peekTaskCount();
+    cmdBuffer->updateTaskCount(csr->peekTaskCount() + 1, csr->getOsContext().getContextId());
+
+    cmdContainer.allocateNextCommandBuffer();
+
+    EXPECT_NE(cmdBuffer, cmdContainer.getCmdBufferAllocations()[1]);
+    EXPECT_TRUE(csr->getInternalAllocationStorage()->getAllocationsForReuse().peekContains(*cmdBuffer));
+    cmdBuffer->updateTaskCount(csr->peekTaskCount(), csr->getOsContext().getContextId());
+}
+
+TEST_F(CommandContainerTest, givenReusePoolMaxSizeExceededWhenResettingCommandContainerThenCompletedCmdBuffersAreReleased) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.CommandContainerReusePoolMaxSize.set(0);
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+    auto &allocationsForReuse = csr->getInternalAllocationStorage()->getAllocationsForReuse();
+    *csr->getTagAddress() = csr->peekTaskCount();
+
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    cmdContainer.allocateNextCommandBuffer();
+    cmdContainer.allocateNextCommandBuffer();
+
+    cmdContainer.reset();
+
+    EXPECT_TRUE(allocationsForReuse.peekIsEmpty());
+    EXPECT_EQ(0u, allocationsForReuse.getReusableSize());
+}
+
+TEST_F(CommandContainerTest, DISABLED_profilingRecordAndResetCommandContainersWithHundredsOfKernels) {
+    DebugManagerStateRestore stateRestore;
+    const uint32_t numCmdContainers = 4u;
+    const uint32_t numKernels = 500u;
+    const uint32_t numFrames = 200u;
+    const size_t cmdSizePerKernel = 2 * MemoryConstants::kiloByte;
+    const size_t dshSizePerKernel = 256u;
+    const size_t sshSizePerKernel = 1 * MemoryConstants::kiloByte;
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+
+    for (auto disableRecycling : {true, false}) {
+        DebugManager.flags.DisableResourceRecycling.set(disableRecycling);
+        std::vector<std::unique_ptr<CommandContainer>> cmdContainers;
+        for (uint32_t i = 0; i < numCmdContainers; i++) {
+            cmdContainers.push_back(std::make_unique<CommandContainer>());
+            cmdContainers.back()->initialize(pDevice);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t frame = 0; frame < numFrames; frame++) {
+            for (auto &cmdContainer : cmdContainers) {
+                for (uint32_t kernel = 0; kernel < numKernels; kernel++) {
+                    if (cmdContainer->getCommandStream()->getAvailableSpace() < cmdSizePerKernel) {
+                        cmdContainer->allocateNextCommandBuffer();
+                    }
+                    cmdContainer->getCommandStream()->getSpace(cmdSizePerKernel);
+                    cmdContainer->getHeapWithRequiredSizeAndAlignment(HeapType::DYNAMIC_STATE, dshSizePerKernel, 64u)->getSpace(dshSizePerKernel);
+                    cmdContainer->getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, sshSizePerKernel, 64u)->getSpace(sshSizePerKernel);
+                }
+            }
+            *csr->getTagAddress() = csr->peekTaskCount();
+            for (auto &cmdContainer : cmdContainers) {
+                cmdContainer->reset();
+            }
+        }
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << "resource recycling " << (disableRecycling ? "disabled" : "enabled") << ", " << numFrames << " frames of " << numCmdContainers
+                  << " command containers with " << numKernels << " kernels: " << time << " us" << std::endl;
+    }
+}
@@ -7,21 +7,29 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/device_binary_format/elf/elf_encoder.h"
+#include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/file_time.h"
 
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/global_environment.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
+#include "os_inc.h"
 #include "test.h"
 
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <sys/stat.h>
+#include <sys/types.h>
 
 using namespace NEO;
 
@@ -219,6 +227,41 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, givenSpecConstantsWhenComputingHashThenTheyAreIncludedInKey) {
+    HardwareInfo hwInfo;
+    const char src[] = "spirv";
+    const char options[] = "-options";
+    ArrayRef<const char> srcRef(src, sizeof(src));
+    ArrayRef<const char> optionsRef(options, sizeof(options));
+
+    specConstValuesMap specConstants = {{1u, 10u}, {2u, 20u}};
+    auto serialized = CompilerInterface::serializeSpecConstants(specConstants);
+    specConstants[2u] = 21u;
+    auto serializedOtherValue = CompilerInterface::serializeSpecConstants(specConstants);
+
+    auto hashWithoutSpecConstants = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, optionsRef);
+    auto hashWithEmptySpecConstants = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, optionsRef,
+                                                                       ArrayRef<const char>(CompilerInterface::serializeSpecConstants({})));
+    auto hash = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, optionsRef, ArrayRef<const char>(serialized));
+    auto hashOtherValue = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, optionsRef, ArrayRef<const char>(serializedOtherValue));
+
+    EXPECT_EQ(hashWithoutSpecConstants, hashWithEmptySpecConstants);
+    EXPECT_NE(hashWithoutSpecConstants, hash);
+    EXPECT_NE(hash, hashOtherValue);
+}
+
+TEST(CompilerCacheHashTests, givenSameSpecConstantsInsertedInDifferentOrderWhenSerializingThenResultIsEqual) {
+    specConstValuesMap specConstants1;
+    specConstValuesMap specConstants2;
+    for (uint32_t i = 0; i < 16; i++) {
+        specConstants1[i] = i * 3u;
+        specConstants2[15 - i] = (15 - i) * 3u;
+    }
+
+    EXPECT_EQ(CompilerInterface::serializeSpecConstants(specConstants1), CompilerInterface::serializeSpecConstants(specConstants2));
+    EXPECT_EQ(16u * (sizeof(uint32_t) + sizeof(uint64_t)), CompilerInterface::serializeSpecConstants(specConstants1).size());
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -253,6 +296,246 @@ TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoad
     EXPECT_NE(0U, size);
 }
 
+struct CompilerCacheBudgetTests : public ::testing::Test {
+    void SetUp() override {
+        config = getDefaultClCompilerCacheConfig();
+        config.cacheFileExtension = ".budget_test_cache";
+        config.cacheSize = 0u;
+        config.inMemoryCacheSize = 0u;
+        for (auto &hash : hashes) {
+            std::remove((config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension).c_str());
+        }
+    }
+
+    void TearDown() override {
+        SetUp();
+    }
+
+    std::string getCachedFilePath(const std::string &hash) const {
+        return config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+    }
+
+    time_t getModificationTime(const std::string &hash) const {
+        struct stat fileStat = {};
+        EXPECT_EQ(0, stat(getCachedFilePath(hash).c_str(), &fileStat));
+        return fileStat.st_mtime;
+    }
+
+    const std::array<std::string, 4> hashes = {{"BUDGET_HASH_0", "BUDGET_HASH_1", "BUDGET_HASH_2", "BUDGET_HASH_3"}};
+    CompilerCacheConfig config;
+    char binary[32] = {1, 2, 3, 4};
+};
+
+TEST_F(CompilerCacheBudgetTests, GivenCacheSizeBudgetWhenCachingOverBudgetThenLeastRecentlyUsedEntryIsEvicted) {
+    config.cacheSize = 3 * sizeof(binary);
+    CompilerCache cache(config);
+
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary(hashes[1], binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary(hashes[2], binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[0], size));
+
+    EXPECT_TRUE(cache.cacheBinary(hashes[3], binary, sizeof(binary)));
+
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[0], size));
+    EXPECT_EQ(nullptr, cache.loadCachedBinary(hashes[1], size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[2], size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[3], size));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenUnlimitedCacheSizeWhenCachingThenNoEntryIsEvicted) {
+    CompilerCache cache(config);
+
+    for (auto &hash : hashes) {
+        EXPECT_TRUE(cache.cacheBinary(hash, binary, sizeof(binary)));
+    }
+
+    size_t size = 0u;
+    for (auto &hash : hashes) {
+        EXPECT_NE(nullptr, cache.loadCachedBinary(hash, size));
+    }
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenEntriesWrittenByOtherCacheInstanceWhenCachingOverBudgetThenExistingFilesAreAccountedAndEvicted) {
+    {
+        CompilerCache previousProcessCache(config);
+        EXPECT_TRUE(previousProcessCache.cacheBinary(hashes[0], binary, sizeof(binary)));
+        EXPECT_TRUE(previousProcessCache.cacheBinary(hashes[1], binary, sizeof(binary)));
+    }
+
+    config.cacheSize = 2 * sizeof(binary);
+    CompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[2], binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[2], size));
+    EXPECT_EQ(1, (nullptr != cache.loadCachedBinary(hashes[0], size)) + (nullptr != cache.loadCachedBinary(hashes[1], size)));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenEntryLoadedByOtherCacheInstanceWhenCachingOverBudgetThenLoadedEntryIsNotEvicted) {
+    {
+        CompilerCache previousProcessCache(config);
+        EXPECT_TRUE(previousProcessCache.cacheBinary(hashes[0], binary, sizeof(binary)));
+        EXPECT_TRUE(previousProcessCache.cacheBinary(hashes[1], binary, sizeof(binary)));
+    }
+    EXPECT_TRUE(setFileModificationTime(config.cacheDir + PATH_SEPARATOR + hashes[0] + config.cacheFileExtension, 1000));
+    EXPECT_TRUE(setFileModificationTime(config.cacheDir + PATH_SEPARATOR + hashes[1] + config.cacheFileExtension, 2000));
+
+    config.cacheSize = 2 * sizeof(binary);
+    size_t size = 0u;
+    {
+        CompilerCache readingProcessCache(config);
+        EXPECT_NE(nullptr, readingProcessCache.loadCachedBinary(hashes[0], size));
+    }
+
+    CompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[2], binary, sizeof(binary)));
+
+    EXPECT_TRUE(fileExists(config.cacheDir + PATH_SEPARATOR + hashes[0] + config.cacheFileExtension));
+    EXPECT_FALSE(fileExists(config.cacheDir + PATH_SEPARATOR + hashes[1] + config.cacheFileExtension));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenEntryNotRefreshedRecentlyWhenLoadingItFromDiskThenModificationTimeIsRefreshed) {
+    {
+        CompilerCache previousProcessCache(config);
+        EXPECT_TRUE(previousProcessCache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    }
+    EXPECT_TRUE(setFileModificationTime(getCachedFilePath(hashes[0]), 1000));
+
+    config.cacheSize = 2 * sizeof(binary);
+    CompilerCache cache(config);
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[0], size));
+    EXPECT_LT(1000, getModificationTime(hashes[0]));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenEntryRefreshedRecentlyWhenLoadingItFromDiskThenModificationTimeIsNotRefreshedAgain) {
+    config.cacheSize = 2 * sizeof(binary);
+    CompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    EXPECT_TRUE(setFileModificationTime(getCachedFilePath(hashes[0]), 1000));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[0], size));
+    EXPECT_EQ(1000, getModificationTime(hashes[0]));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenInMemoryTierHitWhenLoadingBinaryThenModificationTimeIsNotRefreshed) {
+    struct DiskIndexCompilerCache : public CompilerCache {
+        using CompilerCache::CompilerCache;
+        using CompilerCache::diskIndex;
+    };
+
+    config.cacheSize = 2 * sizeof(binary);
+    config.inMemoryCacheSize = sizeof(binary);
+    DiskIndexCompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    cache.diskIndex[hashes[0]].lastModified = 1000;
+    EXPECT_TRUE(setFileModificationTime(getCachedFilePath(hashes[0]), 1000));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[0], size));
+    EXPECT_EQ(1000, getModificationTime(hashes[0]));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenTempFilesLeftInCacheDirWhenCachingWithBudgetThenStaleTempFilesAreRemovedAndRecentOnesAreSkipped) {
+    auto staleTempFile = getCachedFilePath(hashes[0]) + ".stale.tmp";
+    auto recentTempFile = getCachedFilePath(hashes[1]) + ".recent.tmp";
+    EXPECT_EQ(sizeof(binary), writeDataToFile(staleTempFile.c_str(), binary, sizeof(binary)));
+    EXPECT_EQ(sizeof(binary), writeDataToFile(recentTempFile.c_str(), binary, sizeof(binary)));
+    EXPECT_TRUE(setFileModificationTime(staleTempFile, 1000));
+
+    config.cacheSize = 2 * sizeof(binary);
+    CompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[2], binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary(hashes[3], binary, sizeof(binary)));
+
+    EXPECT_FALSE(fileExists(staleTempFile));
+    EXPECT_TRUE(fileExists(recentTempFile));
+    EXPECT_TRUE(fileExists(getCachedFilePath(hashes[2])));
+    EXPECT_TRUE(fileExists(getCachedFilePath(hashes[3])));
+
+    std::remove(staleTempFile.c_str());
+    std::remove(recentTempFile.c_str());
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenInMemoryTierWhenBinaryIsRemovedFromDiskThenItIsStillLoadedFromMemory) {
+    config.inMemoryCacheSize = sizeof(binary);
+    CompilerCache cache(config);
+
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    std::remove((config.cacheDir + PATH_SEPARATOR + hashes[0] + config.cacheFileExtension).c_str());
+
+    size_t size = 0u;
+    auto loadedBinary = cache.loadCachedBinary(hashes[0], size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), sizeof(binary)));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenInMemoryTierBudgetWhenStoringMoreBinariesThenOnlyMostRecentOnesStayInMemory) {
+    config.inMemoryCacheSize = sizeof(binary);
+    CompilerCache cache(config);
+
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary(hashes[1], binary, sizeof(binary)));
+    for (auto &hash : hashes) {
+        std::remove((config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension).c_str());
+    }
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary(hashes[0], size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary(hashes[1], size));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenMappingDisabledWhenMappingCachedBinaryThenNullptrIsReturned) {
+    CompilerCache cache(config);
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    EXPECT_EQ(nullptr, cache.mapCachedBinary(hashes[0]));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenMappingEnabledWhenMappingCachedBinaryThenMappingReferencesCachedBinary) {
+    config.mapCachedBinaries = true;
+    CompilerCache cache(config);
+    EXPECT_EQ(nullptr, cache.mapCachedBinary(hashes[0]));
+
+    EXPECT_TRUE(cache.cacheBinary(hashes[0], binary, sizeof(binary)));
+    auto mappedBinary = cache.mapCachedBinary(hashes[0]);
+    ASSERT_NE(nullptr, mappedBinary);
+    ASSERT_EQ(sizeof(binary), mappedBinary->getData().size());
+    EXPECT_EQ(0, memcmp(binary, mappedBinary->getData().begin(), sizeof(binary)));
+}
+
+TEST_F(CompilerCacheBudgetTests, GivenMappedCachedBinaryAllowedWhenBuildingWithCacheHitThenMappedBinaryIsReturned) {
+    MockDevice device;
+    auto src = "__kernel k() {}";
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    config.mapCachedBinaries = true;
+    auto cache = std::make_unique<CompilerCache>(config);
+    auto kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), inputArgs.src, inputArgs.apiOptions, inputArgs.internalOptions);
+    EXPECT_TRUE(cache->cacheBinary(kernelFileHash, binary, sizeof(binary)));
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+    EXPECT_EQ(nullptr, translationOutput.mappedDeviceBinary);
+    ASSERT_NE(nullptr, translationOutput.deviceBinary.mem);
+    translationOutput.deviceBinary.mem.reset();
+
+    inputArgs.allowMappedCachedBinary = true;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+    EXPECT_EQ(nullptr, translationOutput.deviceBinary.mem);
+    ASSERT_NE(nullptr, translationOutput.mappedDeviceBinary);
+    EXPECT_EQ(sizeof(binary), translationOutput.mappedDeviceBinary->getData().size());
+
+    std::remove((config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension).c_str());
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -368,3 +651,86 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+namespace {
+std::vector<uint8_t> packSourceWithHeader(const char *source, const char *headerName, const char *header) {
+    NEO::Elf::ElfEncoder<> elfEncoder(true, true, 1U);
+    elfEncoder.getElfFileHeader().type = NEO::Elf::ET_OPENCL_SOURCE;
+    elfEncoder.appendSection(NEO::Elf::SHT_OPENCL_SOURCE, "CLMain", ArrayRef<const uint8_t>::fromAny(source, strlen(source) + 1));
+    elfEncoder.appendSection(NEO::Elf::SHT_OPENCL_HEADER, headerName, ArrayRef<const uint8_t>::fromAny(header, strlen(header) + 1));
+    return elfEncoder.encode();
+}
+} // namespace
+
+TEST(CompilerInterfaceCachedTests, givenSourceWithEmbeddedHeadersAndBinaryInCacheWhenCompilingThenFCLIsNotCalled) {
+    auto compileData = packSourceWithHeader("#include \"header.h\"\n__kernel k() {}", "header.h", "#define X 1");
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::spirV};
+    inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(compileData.data()), compileData.size());
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    TranslationOutput translationOutput;
+    MockDevice device;
+    auto err = compilerInterface->compile(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(IGC::CodeType::spirV, translationOutput.intermediateCodeType);
+    EXPECT_NE(nullptr, translationOutput.intermediateRepresentation.mem);
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenSourceIncludingHeaderThatIsNotEmbeddedAndBinaryInCacheWhenCompilingThenFCLIsCalled) {
+    auto compileData = packSourceWithHeader("#include \"file.h\"\n__kernel k() {}", "header.h", "#define X 1");
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::spirV};
+    inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(compileData.data()), compileData.size());
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    TranslationOutput translationOutput;
+    MockDevice device;
+    auto err = compilerInterface->compile(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::CompilationFailure, err);
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenBinaryInCacheWhenLinkingThenIGCIsNotCalled) {
+    auto src = "linkInput";
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    TranslationOutput translationOutput;
+    MockDevice device;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_NE(nullptr, translationOutput.deviceBinary.mem);
+
+    inputArgs.allowCaching = false;
+    err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::LinkFailure, err);
+
+    gEnvironment->igcPopDebugVars();
+}
@@ -5,10 +5,16 @@
  *
  */
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/hash.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +40,83 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(FastHashTests, givenKnownInputsWhenHashIsCalculatedThenReferenceXxHash64ValuesAreReturned) {
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, FastHash::hash("", 0));
+    EXPECT_EQ(0xD24EC4F1A98C6E5BULL, FastHash::hash("a", 1));
+    EXPECT_EQ(0x44BC2CF5AD770999ULL, FastHash::hash("abc", 3));
+
+    const char longInput[] = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(0xFBCEA83C8A378BF1ULL, FastHash::hash(longInput, sizeof(longInput) - 1));
+}
+
+TEST(FastHashTests, givenInputSplitIntoChunksWhenHashIsUpdatedIncrementallyThenResultIsSameAsForWholeInput) {
+    std::vector<char> input(1000);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<char>(i * 7);
+    }
+    auto expected = FastHash::hash(input.data(), input.size());
+
+    for (size_t chunkSize : {1u, 3u, 31u, 32u, 33u, 100u}) {
+        FastHash hash;
+        for (size_t offset = 0; offset < input.size(); offset += chunkSize) {
+            hash.update(input.data() + offset, std::min(chunkSize, input.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(FastHashTests, givenMisalignedBufferWhenHashIsCalculatedThenResultDoesNotDependOnAlignment) {
+    std::vector<char> storage(129);
+    for (size_t i = 0; i < storage.size(); i++) {
+        storage[i] = static_cast<char>(i);
+    }
+    std::vector<char> misalignedStorage(storage.size() + 1);
+    memcpy(misalignedStorage.data() + 1, storage.data(), storage.size());
+
+    EXPECT_EQ(FastHash::hash(storage.data(), storage.size()), FastHash::hash(misalignedStorage.data() + 1, storage.size()));
+}
+
+TEST(FastHashTests, givenResetHashWhenHashIsCalculatedAgainThenSameResultIsReturned) {
+    FastHash hash;
+    hash.update("abcdefgh", 8);
+    auto first = hash.finish();
+    EXPECT_EQ(first, hash.finish());
+
+    hash.reset();
+    hash.update("abcdefgh", 8);
+    EXPECT_EQ(first, hash.finish());
+
+    hash.update(nullptr, 8);
+    EXPECT_EQ(first, hash.finish());
+}
+
+TEST(FastHashTests, DISABLED_profilingFastHashVsJenkinsHashOnMultiMegabyteInput) {
+    constexpr size_t inputSize = 16 * MemoryConstants::megaByte;
+    constexpr uint32_t maxLoop = 10u;
+    std::vector<char> input(inputSize);
+    for (size_t i = 0; i < inputSize; i++) {
+        input[i] = static_cast<char>(i * 31);
+    }
+
+    uint64_t jenkinsResult = 0;
+    auto jenkinsStart = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < maxLoop; i++) {
+        jenkinsResult ^= Hash::hash(input.data(), input.size());
+    }
+    auto jenkinsEnd = std::chrono::high_resolution_clock::now();
+
+    uint64_t fastResult = 0;
+    auto fastStart = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < maxLoop; i++) {
+        fastResult ^= FastHash::hash(input.data(), input.size());
+    }
+    auto fastEnd = std::chrono::high_resolution_clock::now();
+
+    auto jenkinsMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(jenkinsEnd - jenkinsStart).count() / maxLoop;
+    auto fastMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(fastEnd - fastStart).count() / maxLoop;
+
+    printf("\nInput size: %zu bytes, Jenkins: %lld us, FastHash: %lld us (results %llx %llx)\n",
+           inputSize, static_cast<long long>(jenkinsMicroseconds), static_cast<long long>(fastMicroseconds),
+           static_cast<unsigned long long>(jenkinsResult), static_cast<unsigned long long>(fastResult));
+}
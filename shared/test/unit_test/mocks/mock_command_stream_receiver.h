@@ -40,7 +40,7 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     bool downloadAllocationsCalled = false;
     bool programHardwareContextCalled = false;
 
-    bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) override {
+    bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait, FlushStamp flushStampToWait) override {
         waitForCompletionWithTimeoutCalled++;
         return true;
     }
@@ -14,6 +14,9 @@
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 
+#include <chrono>
+#include <cstdio>
+
 using namespace NEO;
 
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenInsertingAllocsThenAllocsAreTrackedByPageFaultManager) {
@@ -261,13 +264,14 @@ TEST_F(PageFaultManagerTest, givenInitialPlacementGpuWhenVerifyingPagefaultThenF
     EXPECT_EQ(pageFaultManager->protectedSize, 10u);
     pageFaultManager->verifyPageFault(alloc);
 
-    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectFromWritesCalled, 1);
     EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
     EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
     EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
 
-    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
-    EXPECT_EQ(pageFaultManager->accessAllowedSize, 10u);
+    EXPECT_EQ(pageFaultManager->protectedFromWritesAddress, alloc);
+    EXPECT_EQ(pageFaultManager->protectedFromWritesSize, 10u);
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
@@ -367,3 +371,224 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledTh
 
     unifiedMemoryManager->freeSVMAlloc(alloc1);
 }
+
+TEST_F(PageFaultManagerTest, givenAllocationInGpuDomainWhenCpuReadsOneChunkThenOnlyThisChunkIsTransferredAndNothingIsCopiedBack) {
+    constexpr auto chunkSize = PageFaultManager::migrationChunkSize;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, 16 * chunkSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, 16 * chunkSize);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 5 * chunkSize + 100));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferredToCpuBytes, chunkSize);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(pageFaultManager->protectFromWritesCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedFromWritesAddress, ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(pageFaultManager->protectedFromWritesSize, chunkSize);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks[5], PageFaultManager::ChunkState::CpuRead);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, 16 * chunkSize);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 2);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(pageFaultManager->protectedSize, chunkSize);
+}
+
+TEST_F(PageFaultManagerTest, givenOtherThreadsNotStoppedWhenCpuTouchesChunkInGpuDomainThenChunkStaysWritableAndIsMarkedForCopyBack) {
+    constexpr auto chunkSize = PageFaultManager::migrationChunkSize;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->otherThreadsStopped = false;
+    pageFaultManager->insertAllocation(alloc, 16 * chunkSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, 16 * chunkSize);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 5 * chunkSize + 100));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, chunkSize);
+    EXPECT_EQ(pageFaultManager->protectFromWritesCalled, 0);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks[5], PageFaultManager::ChunkState::CpuWrite);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, 17 * chunkSize);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, 5 * chunkSize));
+}
+
+TEST_F(PageFaultManagerTest, givenChunksWrittenByCpuWhenMovingToGpuDomainThenOnlyWrittenChunksAreCopiedBackInMergedRanges) {
+    constexpr auto chunkSize = PageFaultManager::migrationChunkSize;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.flags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 16 * chunkSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, memoryProperties);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    // read and then write of chunks 2 and 3, read only of chunk 7
+    for (auto chunk : {2u, 2u, 3u, 3u, 7u}) {
+        pageFaultManager->verifyPageFault(ptrOffset(alloc, chunk * chunkSize));
+    }
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 3);
+    EXPECT_EQ(pageFaultManager->transferredToCpuBytes, 3 * chunkSize);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 5);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks[2], PageFaultManager::ChunkState::CpuWrite);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks[3], PageFaultManager::ChunkState::CpuWrite);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks[7], PageFaultManager::ChunkState::CpuRead);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, 2 * chunkSize);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, 2 * chunkSize));
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, 2 * chunkSize);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 3);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, 7 * chunkSize));
+    EXPECT_EQ(pageFaultManager->protectedSize, chunkSize);
+    for (auto chunkState : pageFaultManager->memoryData[alloc].chunks) {
+        EXPECT_EQ(chunkState, PageFaultManager::ChunkState::Gpu);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenLargeAllocationWhenCpuWritesSingleElementThenOnlyOneChunkIsMigratedInBothDirections) {
+    constexpr auto chunkSize = PageFaultManager::migrationChunkSize;
+    constexpr size_t allocationSize = MemoryConstants::gigaByte;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000000);
+
+    pageFaultManager->insertAllocation(alloc, allocationSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->transferredToGpuBytes = 0;
+
+    auto element = ptrOffset(alloc, allocationSize / 2 + 8);
+    pageFaultManager->verifyPageFault(element);
+    pageFaultManager->verifyPageFault(element);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_EQ(pageFaultManager->transferredToCpuBytes, chunkSize);
+    EXPECT_EQ(pageFaultManager->transferredToGpuBytes, chunkSize);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, allocationSize / 2));
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationSizeNotMultipleOfChunkSizeWhenLastChunkIsMigratedThenTransfersEndAtAllocationEnd) {
+    constexpr auto chunkSize = PageFaultManager::migrationChunkSize;
+    constexpr size_t allocationSize = 2 * chunkSize + 4096;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, allocationSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunks.size(), 3u);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, allocationSize);
+    EXPECT_EQ(pageFaultManager->protectedSize, allocationSize);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, allocationSize - 1));
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, 2 * chunkSize));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, 4096u);
+    EXPECT_EQ(pageFaultManager->protectedFromWritesSize, 4096u);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationWithChunksProtectedFromWritesWhenRemovingThenWholeAllocationIsAccessible) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, 4 * PageFaultManager::migrationChunkSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 4 * PageFaultManager::migrationChunkSize);
+}
+
+TEST_F(PageFaultManagerTest, givenManyAllocationsWhenVerifyingPageFaultThenOnlyAddressesWithinAllocationsAreHandled) {
+    for (uintptr_t i = 1; i <= 100; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(i * 0x10000), 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    }
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(57 * 0x10000 + 0xfff)));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, reinterpret_cast<void *>(57 * 0x10000));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(100 * 0x10000)));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, reinterpret_cast<void *>(100 * 0x10000));
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(57 * 0x10000 + 0x1000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xffff)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(101 * 0x10000)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationsMovedToGpuDomainWhenCpuTouchesOneOfThemThenOnlyThisAllocationIsMigratedByUnifiedMemoryManager) {
+    auto svmAllocsManager = reinterpret_cast<SVMAllocsManager *>(0x1111);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x100000);
+    void *alloc2 = reinterpret_cast<void *>(0x200000);
+    void *alloc3 = reinterpret_cast<void *>(0x300000);
+
+    for (auto alloc : {alloc1, alloc2, alloc3}) {
+        pageFaultManager->insertAllocation(alloc, 0x1000, svmAllocsManager, cmdQ, {});
+    }
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].size(), 3u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(svmAllocsManager);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 3);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].empty());
+
+    pageFaultManager->verifyPageFault(alloc2);
+    pageFaultManager->verifyPageFault(alloc2);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].size(), 1u);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].count(alloc2), 1u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(svmAllocsManager);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 4);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc2);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].empty());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(svmAllocsManager);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 4);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationNotInGpuDomainWhenRemovingOrMovingItToGpuDomainThenItIsNoLongerTrackedForMigration) {
+    auto svmAllocsManager = reinterpret_cast<SVMAllocsManager *>(0x1111);
+    void *alloc1 = reinterpret_cast<void *>(0x100000);
+    void *alloc2 = reinterpret_cast<void *>(0x200000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, svmAllocsManager, nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, svmAllocsManager, nullptr, {});
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].size(), 2u);
+
+    pageFaultManager->removeAllocation(alloc1);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].count(alloc1), 0u);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc2);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocs[svmAllocsManager].empty());
+}
+
+TEST_F(PageFaultManagerTest, DISABLED_profilingPageFaultLookupAndMigrationWithManySharedAllocations) {
+    constexpr uintptr_t allocationsCount = 8192;
+    constexpr size_t lookupsCount = 1000000;
+    auto svmAllocsManager = reinterpret_cast<SVMAllocsManager *>(0x1111);
+
+    for (uintptr_t i = 1; i <= allocationsCount; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(i * MemoryConstants::megaByte), MemoryConstants::pageSize64k,
+                                           svmAllocsManager, nullptr, {});
+    }
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(svmAllocsManager);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < lookupsCount; i++) {
+        auto alloc = (i * 7919) % allocationsCount + 1;
+        pageFaultManager->verifyPageFault(reinterpret_cast<void *>(alloc * MemoryConstants::megaByte + 64));
+        pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(svmAllocsManager);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    printf("%zu page faults and migrations with %zu allocations: %.1f ms\n", lookupsCount, static_cast<size_t>(allocationsCount),
+           std::chrono::duration<double, std::milli>(end - start).count());
+}
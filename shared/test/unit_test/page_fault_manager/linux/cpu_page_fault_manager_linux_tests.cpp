@@ -16,6 +16,8 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <chrono>
 #include <csignal>
 #include <sys/mman.h>
 #include <sys/syscall.h>
@@ -43,11 +45,11 @@ struct UserSignalMockPageFaultManagerLinux : public PageFaultManagerLinux {
     }
 
     void allowCPUMemoryAccess(void *ptr, size_t size) override {}
-    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {}
+    void transferToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {}
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
 
-    void sendSignalToThread(int threadId) override {
-        PageFaultManagerLinux::sendSignalToThread(ownThreadId);
+    bool sendSignalToThread(int threadId) override {
+        return PageFaultManagerLinux::sendSignalToThread(ownThreadId);
     }
 
     void waitForCopy() override {
@@ -71,6 +73,82 @@ TEST_F(PageFaultManagerLinuxTest, whenVeryfyingPageFaultThenUserSignalIsSentToOt
     EXPECT_TRUE(pageFaultManager->waitForCopyCalled);
 }
 
+struct SignaledThreadsMockPageFaultManagerLinux : public PageFaultManagerLinux {
+    using PageFaultManagerLinux::maxWaitForSignaledThreadsTimeUs;
+    using PageFaultManagerLinux::waitForSignaledThreads;
+    using PageFaultManagerLinux::waitForSignaledThreadsEnabled;
+    using PageFaultManagerLinux::waitingThreadsCount;
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenAllSignaledThreadsWaitingWhenWaitingForSignaledThreadsThenTrueIsReturned) {
+    auto pageFaultManager = std::make_unique<SignaledThreadsMockPageFaultManagerLinux>();
+    EXPECT_TRUE(pageFaultManager->waitForSignaledThreads(0u));
+
+    pageFaultManager->waitingThreadsCount = 2u;
+    EXPECT_TRUE(pageFaultManager->waitForSignaledThreads(2u));
+    EXPECT_TRUE(pageFaultManager->waitForSignaledThreadsEnabled);
+}
+
+TEST_F(PageFaultManagerLinuxTest, givenSignaledThreadNotWaitingWhenWaitingForSignaledThreadsThenFalseIsReturnedAfterTimeoutAndWaitingIsDisabled) {
+    auto pageFaultManager = std::make_unique<SignaledThreadsMockPageFaultManagerLinux>();
+    pageFaultManager->waitingThreadsCount = 1u;
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(pageFaultManager->waitForSignaledThreads(2u));
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_GE(elapsedUs, SignaledThreadsMockPageFaultManagerLinux::maxWaitForSignaledThreadsTimeUs);
+    EXPECT_FALSE(pageFaultManager->waitForSignaledThreadsEnabled);
+
+    pageFaultManager->waitingThreadsCount = 2u;
+    EXPECT_FALSE(pageFaultManager->waitForSignaledThreads(2u));
+}
+
+struct RunningThreadsMockPageFaultManagerLinux : public PageFaultManagerLinux {
+    using PageFaultManager::memoryData;
+    using PageFaultManagerLinux::waitForSignaledThreadsEnabled;
+
+    void transferToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {}
+    void transferToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {}
+    void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenOtherThreadsRunningWhenCpuTouchesChunksInGpuDomainRepeatedlyThenOtherThreadsAreStoppedEachTimeAndReadChunkIsMappedReadOnly) {
+    auto pageFaultManager = std::make_unique<RunningThreadsMockPageFaultManagerLinux>();
+
+    std::atomic<bool> stopThreads{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&stopThreads]() {
+            while (!stopThreads) {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    auto size = 2 * PageFaultManager::migrationChunkSize;
+    auto ptr = static_cast<int *>(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+    pageFaultManager->insertAllocation(ptr, size, nullptr, nullptr, {});
+
+    ptr[0] = 1;
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    EXPECT_EQ(PageFaultManager::ChunkState::Gpu, pageFaultManager->memoryData[ptr].chunks[0]);
+
+    volatile int value = ptr[0];
+    EXPECT_EQ(1, value);
+    EXPECT_EQ(PageFaultManager::ChunkState::CpuRead, pageFaultManager->memoryData[ptr].chunks[0]);
+
+    ptr[0] = 2;
+    EXPECT_EQ(PageFaultManager::ChunkState::CpuWrite, pageFaultManager->memoryData[ptr].chunks[0]);
+    EXPECT_TRUE(pageFaultManager->waitForSignaledThreadsEnabled);
+
+    stopThreads = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    pageFaultManager->removeAllocation(ptr);
+    munmap(ptr, size);
+}
+
 TEST_F(PageFaultManagerLinuxTest, whenPageFaultIsRaisedThenHandlerIsInvoked) {
     auto pageFaultManager = std::make_unique<MockPageFaultManagerLinux>();
     EXPECT_FALSE(pageFaultManager->handlerInvoked);
@@ -167,6 +245,23 @@ TEST_F(PageFaultManagerLinuxTest, givenProtectedMemoryWhenTryingToAccessThenPage
     EXPECT_EQ(ptr[0], 10);
 }
 
+TEST_F(PageFaultManagerLinuxTest, givenMemoryProtectedFromWritesWhenAccessingThenOnlyWriteRaisesPageFault) {
+    auto pageFaultManager = std::make_unique<MockPageFaultManagerLinux>();
+    pageFaultManager->allowCPUMemoryAccessOnPageFault = true;
+    auto ptr = static_cast<int *>(mmap(nullptr, pageFaultManager->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+    ptr[0] = 10;
+
+    pageFaultManager->protectCPUMemoryFromWrites(ptr, pageFaultManager->size);
+
+    EXPECT_EQ(static_cast<volatile int *>(ptr)[0], 10);
+    EXPECT_FALSE(pageFaultManager->handlerInvoked);
+    ptr[0] = 20;
+    EXPECT_TRUE(pageFaultManager->handlerInvoked);
+    EXPECT_EQ(ptr[0], 20);
+
+    munmap(ptr, pageFaultManager->size);
+}
+
 class MockFailPageFaultManager : public PageFaultManagerLinux {
   public:
     using PageFaultManagerLinux::callPreviousHandler;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 using namespace NEO;
@@ -14,6 +15,7 @@ using namespace NEO;
 class MockPageFaultManager : public PageFaultManager {
   public:
     using PageFaultManager::memoryData;
+    using PageFaultManager::nonGpuDomainAllocs;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::verifyPageFault;
@@ -28,14 +30,22 @@ class MockPageFaultManager : public PageFaultManager {
         protectedMemoryAccessAddress = ptr;
         protectedSize = size;
     }
-    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+    void protectCPUMemoryFromWrites(void *ptr, size_t size) override {
+        protectFromWritesCalled++;
+        protectedFromWritesAddress = ptr;
+        protectedFromWritesSize = size;
+    }
+    void transferToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
         transferToCpuCalled++;
-        transferToCpuAddress = ptr;
+        transferToCpuAddress = ptrOffset(ptr, offset);
         transferToCpuSize = size;
+        transferredToCpuBytes += size;
     }
-    void transferToGpu(void *ptr, void *cmdQ) override {
+    void transferToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
         transferToGpuCalled++;
-        transferToGpuAddress = ptr;
+        transferToGpuAddress = ptrOffset(ptr, offset);
+        transferToGpuSize = size;
+        transferredToGpuBytes += size;
     }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
@@ -43,26 +53,33 @@ class MockPageFaultManager : public PageFaultManager {
     void baseAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
         PageFaultManager::setAubWritable(writable, ptr, unifiedMemoryManager);
     }
-    void baseCpuTransfer(void *ptr, size_t size, void *cmdQ) {
-        PageFaultManager::transferToCpu(ptr, size, cmdQ);
+    void baseCpuTransfer(void *ptr, size_t offset, size_t size, void *cmdQ) {
+        PageFaultManager::transferToCpu(ptr, offset, size, cmdQ);
     }
-    void baseGpuTransfer(void *ptr, void *cmdQ) {
-        PageFaultManager::transferToGpu(ptr, cmdQ);
+    void baseGpuTransfer(void *ptr, size_t offset, size_t size, void *cmdQ) {
+        PageFaultManager::transferToGpu(ptr, offset, size, cmdQ);
     }
-    void broadcastWaitSignal() override {}
+    bool broadcastWaitSignal() override { return otherThreadsStopped; }
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override {}
 
+    bool otherThreadsStopped = true;
     int allowMemoryAccessCalled = 0;
     int protectMemoryCalled = 0;
+    int protectFromWritesCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
+    void *protectedFromWritesAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferToGpuSize = 0;
+    size_t transferredToCpuBytes = 0;
+    size_t transferredToGpuBytes = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
+    size_t protectedFromWritesSize = 0;
     bool isAubWritable = true;
 };
 
@@ -72,6 +89,7 @@ class MockPageFaultManagerHandlerInvoke : public T {
     using T::allowCPUMemoryAccess;
     using T::evictMemoryAfterImplCopy;
     using T::protectCPUMemoryAccess;
+    using T::protectCPUMemoryFromWrites;
     using T::T;
 
     bool verifyPageFault(void *ptr) override {
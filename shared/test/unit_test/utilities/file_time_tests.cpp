@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/file_time.h"
+
+#include "test.h"
+
+#include <cstdio>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+using namespace NEO;
+
+TEST(FileTimeTest, GivenExistingFileWhenSettingModificationTimeThenItIsReportedByStat) {
+    const char *fileName = "file_time_test.tmp";
+    const char contents[] = "file time contents";
+    EXPECT_EQ(sizeof(contents), writeDataToFile(fileName, contents, sizeof(contents)));
+
+    EXPECT_TRUE(setFileModificationTime(fileName, 1000));
+    struct stat fileStat = {};
+    EXPECT_EQ(0, stat(fileName, &fileStat));
+    EXPECT_EQ(1000, fileStat.st_mtime);
+
+    std::remove(fileName);
+}
+
+TEST(FileTimeTest, GivenNonExistingFileWhenSettingModificationTimeThenFalseIsReturned) {
+    EXPECT_FALSE(setFileModificationTime("----file-time-does-not-exist----", 1000));
+}
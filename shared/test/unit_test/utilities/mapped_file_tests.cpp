@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/mapped_file.h"
+
+#include "test.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+TEST(MappedFileTest, GivenExistingFileWhenOpeningReadOnlyThenContentsAreAccessibleThroughMapping) {
+    const char *fileName = "mapped_file_test.tmp";
+    const char contents[] = "mapped file contents";
+    EXPECT_EQ(sizeof(contents), writeDataToFile(fileName, contents, sizeof(contents)));
+
+    auto mappedFile = MappedFile::openReadOnly(fileName);
+    ASSERT_NE(nullptr, mappedFile);
+    auto data = mappedFile->getData();
+    ASSERT_EQ(sizeof(contents), data.size());
+    EXPECT_EQ(0, memcmp(contents, data.begin(), sizeof(contents)));
+
+    mappedFile.reset();
+    std::remove(fileName);
+}
+
+TEST(MappedFileTest, GivenMappedFileWhenFileIsRemovedThenMappingStaysValid) {
+    const char *fileName = "mapped_file_test_removed.tmp";
+    const char contents[] = "mapped file contents";
+    EXPECT_EQ(sizeof(contents), writeDataToFile(fileName, contents, sizeof(contents)));
+
+    auto mappedFile = MappedFile::openReadOnly(fileName);
+    ASSERT_NE(nullptr, mappedFile);
+    std::remove(fileName);
+
+    auto data = mappedFile->getData();
+    ASSERT_EQ(sizeof(contents), data.size());
+    EXPECT_EQ(0, memcmp(contents, data.begin(), sizeof(contents)));
+}
+
+TEST(MappedFileTest, GivenNonExistingFileWhenOpeningReadOnlyThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, MappedFile::openReadOnly("----mapped-file-does-not-exist----"));
+}
+
+TEST(MappedFileTest, GivenEmptyFileWhenOpeningReadOnlyThenNullptrIsReturned) {
+    const char *fileName = "mapped_file_test_empty.tmp";
+    FILE *fp = fopen(fileName, "wb");
+    ASSERT_NE(nullptr, fp);
+    fclose(fp);
+
+    EXPECT_EQ(nullptr, MappedFile::openReadOnly(fileName));
+    std::remove(fileName);
+}
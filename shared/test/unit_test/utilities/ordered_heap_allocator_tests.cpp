@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/ordered_heap_allocator.h"
+
+#include "test.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+const size_t orderedSizeThreshold = 16 * 4096;
+
+class OrderedHeapAllocatorUnderTest : public OrderedHeapAllocator {
+  public:
+    using OrderedHeapAllocator::OrderedHeapAllocator;
+
+    uint64_t getLeftBound() const { return this->pLeftBound; }
+    uint64_t getRightBound() const { return this->pRightBound; }
+    size_t getFreedChunksSmallCount() const { return this->freedChunksSmall.byAddress.size(); }
+    size_t getFreedChunksBigCount() const { return this->freedChunksBig.byAddress.size(); }
+};
+
+struct HeapAllocation {
+    uint64_t ptr;
+    size_t size;
+};
+
+template <typename AllocatorT>
+uint64_t runChurn(AllocatorT &allocator, uint32_t seed, size_t iterations, size_t liveAllocations) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> smallPages(1, 16);
+    std::uniform_int_distribution<size_t> bigPages(17, 512);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+
+    std::vector<HeapAllocation> allocations;
+    allocations.reserve(liveAllocations);
+    uint64_t failedAllocations = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        if (allocations.size() < liveAllocations) {
+            size_t size = ((percent(generator) < 90) ? smallPages(generator) : bigPages(generator)) * MemoryConstants::pageSize;
+            auto ptr = allocator.allocate(size);
+            if (ptr == 0llu) {
+                failedAllocations++;
+            } else {
+                allocations.push_back({ptr, size});
+            }
+        } else {
+            std::uniform_int_distribution<size_t> victim(0, allocations.size() - 1);
+            auto index = victim(generator);
+            allocator.free(allocations[index].ptr, allocations[index].size);
+            allocations[index] = allocations.back();
+            allocations.pop_back();
+        }
+    }
+    for (auto &allocation : allocations) {
+        allocator.free(allocation.ptr, allocation.size);
+    }
+    return failedAllocations;
+}
+} // namespace
+
+TEST(OrderedHeapAllocatorTest, WhenAllocatingThenSmallAllocationsComeFromTopAndBigFromBottom) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t smallSize = 4096;
+    auto ptrSmall = heapAllocator.allocate(smallSize);
+    EXPECT_EQ(ptrBase + size - 4096, ptrSmall);
+
+    size_t bigSize = orderedSizeThreshold * 2;
+    auto ptrBig = heapAllocator.allocate(bigSize);
+    EXPECT_EQ(ptrBase, ptrBig);
+    EXPECT_EQ(smallSize + bigSize, heapAllocator.getUsedSize());
+
+    heapAllocator.free(ptrSmall, smallSize);
+    heapAllocator.free(ptrBig, bigSize);
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    EXPECT_EQ(ptrBase, heapAllocator.getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator.getRightBound());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenAdjacentFreedChunksWhenFreeingThenChunksAreCoalesced) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    uint64_t ptrs[5];
+    for (auto &ptr : ptrs) {
+        size_t allocSize = 4096;
+        ptr = heapAllocator.allocate(allocSize);
+    }
+
+    heapAllocator.free(ptrs[1], 4096);
+    heapAllocator.free(ptrs[3], 4096);
+    EXPECT_EQ(2u, heapAllocator.getFreedChunksSmallCount());
+
+    heapAllocator.free(ptrs[2], 4096);
+    EXPECT_EQ(1u, heapAllocator.getFreedChunksSmallCount());
+
+    heapAllocator.free(ptrs[0], 4096);
+    EXPECT_EQ(1u, heapAllocator.getFreedChunksSmallCount());
+
+    heapAllocator.free(ptrs[4], 4096);
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksSmallCount());
+    EXPECT_EQ(ptrBase + size, heapAllocator.getRightBound());
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenBigFreedChunkNextToLeftBoundWhenFreeingThenBoundIsMovedBack) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t bigSize = orderedSizeThreshold * 2;
+    auto ptr0 = heapAllocator.allocate(bigSize);
+    auto ptr1 = heapAllocator.allocate(bigSize);
+    auto ptr2 = heapAllocator.allocate(bigSize);
+
+    heapAllocator.free(ptr1, bigSize);
+    EXPECT_EQ(1u, heapAllocator.getFreedChunksBigCount());
+
+    heapAllocator.free(ptr2, bigSize);
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksBigCount());
+    EXPECT_EQ(ptr1, heapAllocator.getLeftBound());
+
+    heapAllocator.free(ptr0, bigSize);
+    EXPECT_EQ(ptrBase, heapAllocator.getLeftBound());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenFreedChunksWhenAllocatingThenSmallestFittingChunkIsUsed) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t sizes[] = {4 * 4096, 4096, 2 * 4096, 4096, 3 * 4096, 4096};
+    uint64_t ptrs[6];
+    for (int i = 0; i < 6; i++) {
+        ptrs[i] = heapAllocator.allocate(sizes[i]);
+    }
+    heapAllocator.free(ptrs[0], sizes[0]);
+    heapAllocator.free(ptrs[2], sizes[2]);
+    heapAllocator.free(ptrs[4], sizes[4]);
+    EXPECT_EQ(3u, heapAllocator.getFreedChunksSmallCount());
+
+    size_t allocSize = 2 * 4096;
+    EXPECT_EQ(ptrs[2], heapAllocator.allocate(allocSize));
+    EXPECT_EQ(2u * 4096, allocSize);
+
+    allocSize = 3 * 4096;
+    EXPECT_EQ(ptrs[4], heapAllocator.allocate(allocSize));
+    EXPECT_EQ(1u, heapAllocator.getFreedChunksSmallCount());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenFreedChunkSmallerThanTwiceRequestedSizeWhenAllocatingThenWholeChunkIsReturned) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t chunkSize = 3 * 4096;
+    auto ptr = heapAllocator.allocate(chunkSize);
+    size_t guardSize = 4096;
+    heapAllocator.allocate(guardSize);
+    heapAllocator.free(ptr, chunkSize);
+    auto usedSize = heapAllocator.getUsedSize();
+
+    size_t allocSize = 2 * 4096;
+    EXPECT_EQ(ptr, heapAllocator.allocate(allocSize));
+    EXPECT_EQ(chunkSize, allocSize);
+    EXPECT_EQ(usedSize + chunkSize, heapAllocator.getUsedSize());
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksSmallCount());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenFreedChunkAtLeastTwiceRequestedSizeWhenAllocatingThenChunkIsSplitFromTop) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t chunkSize = 8 * 4096;
+    auto ptr = heapAllocator.allocate(chunkSize);
+    size_t guardSize = 4096;
+    heapAllocator.allocate(guardSize);
+    heapAllocator.free(ptr, chunkSize);
+
+    size_t allocSize = 2 * 4096;
+    EXPECT_EQ(ptr + 6 * 4096, heapAllocator.allocate(allocSize));
+    EXPECT_EQ(2u * 4096, allocSize);
+    EXPECT_EQ(1u, heapAllocator.getFreedChunksSmallCount());
+
+    allocSize = 6 * 4096;
+    EXPECT_EQ(ptr, heapAllocator.allocate(allocSize));
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksSmallCount());
+}
+
+TEST(OrderedHeapAllocatorTest, GivenExhaustedHeapWhenAllocatingThenZeroIsReturned) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 16 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    size_t allocSize = size;
+    auto ptr = heapAllocator.allocate(allocSize);
+    EXPECT_NE(0llu, ptr);
+
+    size_t nextSize = 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(nextSize));
+
+    heapAllocator.free(ptr, allocSize);
+    nextSize = 4096;
+    EXPECT_NE(0llu, heapAllocator.allocate(nextSize));
+}
+
+TEST(OrderedHeapAllocatorTest, GivenFragmentedHeapWithEnoughFreeSpaceButNoFittingChunkWhenAllocatingThenZeroIsReturned) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 8 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    uint64_t ptrs[8];
+    for (auto &ptr : ptrs) {
+        size_t allocSize = 4096;
+        ptr = heapAllocator.allocate(allocSize);
+    }
+    for (int i = 0; i < 8; i += 2) {
+        heapAllocator.free(ptrs[i], 4096);
+    }
+    EXPECT_EQ(4u * 4096, heapAllocator.getLeftSize());
+
+    size_t allocSize = 2 * 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(allocSize));
+}
+
+TEST(OrderedHeapAllocatorTest, GivenRandomChurnWhenAllAllocationsAreFreedThenWholeHeapIsAvailableAgain) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 4096 * 4096;
+    OrderedHeapAllocatorUnderTest heapAllocator(ptrBase, size, orderedSizeThreshold);
+
+    runChurn(heapAllocator, 0u, 20000u, 256u);
+
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksSmallCount());
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksBigCount());
+    EXPECT_EQ(ptrBase, heapAllocator.getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator.getRightBound());
+}
+
+TEST(OrderedHeapAllocatorTest, DISABLED_profilingChurnOrderedHeapAllocatorVsHeapAllocator) {
+    uint64_t ptrBase = 0x100000llu;
+    uint64_t size = 64 * MemoryConstants::gigaByte;
+    const size_t iterations = 1000000u;
+    const size_t liveAllocations[] = {256u, 4096u, 32768u};
+
+    for (auto live : liveAllocations) {
+        HeapAllocator heapAllocator(ptrBase, size);
+        auto start = std::chrono::high_resolution_clock::now();
+        auto failedLegacy = runChurn(heapAllocator, 1u, iterations, live);
+        auto legacyTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+        OrderedHeapAllocator orderedHeapAllocator(ptrBase, size);
+        start = std::chrono::high_resolution_clock::now();
+        auto failedOrdered = runChurn(orderedHeapAllocator, 1u, iterations, live);
+        auto orderedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "live allocations: " << live << std::endl
+                  << "HeapAllocator:        " << legacyTime << " us, failed allocations: " << failedLegacy << std::endl
+                  << "OrderedHeapAllocator: " << orderedTime << " us, failed allocations: " << failedOrdered << std::endl;
+    }
+}
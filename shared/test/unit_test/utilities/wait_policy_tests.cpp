@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/wait_policy.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+extern std::atomic<uint32_t> pauseCounter;
+
+using namespace NEO;
+
+using WaitPhase = WaitPolicy::WaitPhase;
+
+TEST(WaitPolicyTest, givenDefaultSettingsWhenCreatingWaitPolicyThenDefaultSpinTimeAndBlockingWaitAreUsed) {
+    WaitPolicy waitPolicy;
+    EXPECT_EQ(WaitPolicy::defaultSpinTimeUs, waitPolicy.getSpinTimeUs());
+    EXPECT_TRUE(waitPolicy.isBlockingWaitEnabled());
+}
+
+TEST(WaitPolicyTest, givenDebugFlagsSetWhenCreatingWaitPolicyThenSpinTimeAndBlockingWaitAreOverridden) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(7);
+    DebugManager.flags.EnableWaitPolicyBlockingWait.set(0);
+
+    WaitPolicy waitPolicy;
+    EXPECT_EQ(7, waitPolicy.getSpinTimeUs());
+    EXPECT_FALSE(waitPolicy.isBlockingWaitEnabled());
+}
+
+TEST(WaitPolicyTest, givenWaitTimesWhenGettingHistogramBucketThenPowerOfTwoBucketIsReturned) {
+    const size_t lastBucket = WaitPolicy::histogramBucketCount - 1;
+    EXPECT_EQ(0u, WaitPolicy::getHistogramBucket(0));
+    EXPECT_EQ(1u, WaitPolicy::getHistogramBucket(1));
+    EXPECT_EQ(2u, WaitPolicy::getHistogramBucket(2));
+    EXPECT_EQ(2u, WaitPolicy::getHistogramBucket(3));
+    EXPECT_EQ(3u, WaitPolicy::getHistogramBucket(4));
+    EXPECT_EQ(lastBucket, WaitPolicy::getHistogramBucket(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(WaitPolicyTest, givenCompletedConditionWhenWaitingThenReturnImmediatelyWithoutPauseBlockingWaitOrHistogramUpdate) {
+    WaitPolicy waitPolicy;
+    uint32_t blockingWaitCalled = 0u;
+    auto pausesBefore = pauseCounter.load();
+
+    EXPECT_TRUE(waitPolicy.wait([]() { return true; }, [&]() { blockingWaitCalled++; }, false, 0));
+
+    EXPECT_EQ(pausesBefore, pauseCounter.load());
+    EXPECT_EQ(0u, blockingWaitCalled);
+    for (uint32_t phase = 0; phase < static_cast<uint32_t>(WaitPhase::Count); phase++) {
+        EXPECT_EQ(0u, waitPolicy.getWaitCount(static_cast<WaitPhase>(phase)));
+    }
+}
+
+TEST(WaitPolicyTest, givenConditionCompletedDuringSpinWhenWaitingThenPausesBackOffExponentiallyAndSpinPhaseIsRecorded) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(10000000);
+
+    WaitPolicy waitPolicy;
+    uint32_t checks = 0u;
+    uint32_t blockingWaitCalled = 0u;
+    auto pausesBefore = pauseCounter.load();
+
+    EXPECT_TRUE(waitPolicy.wait([&]() { return ++checks == 5u; }, [&]() { blockingWaitCalled++; }, false, 0));
+
+    EXPECT_EQ(1u + 2u + 4u + 8u, pauseCounter.load() - pausesBefore);
+    EXPECT_EQ(0u, blockingWaitCalled);
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Spin));
+    EXPECT_EQ(0u, waitPolicy.getWaitCount(WaitPhase::Block));
+}
+
+TEST(WaitPolicyTest, givenConditionNotCompletedAfterSpinWhenWaitingWithoutTimeoutThenBlockingWaitIsCalledOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+
+    WaitPolicy waitPolicy;
+    bool completed = false;
+    uint32_t blockingWaitCalled = 0u;
+
+    EXPECT_TRUE(waitPolicy.wait([&]() { return completed; }, [&]() { blockingWaitCalled++; completed = true; }, false, 0));
+
+    EXPECT_EQ(1u, blockingWaitCalled);
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Block));
+    EXPECT_EQ(0u, waitPolicy.getWaitCount(WaitPhase::Spin));
+}
+
+TEST(WaitPolicyTest, givenBlockingWaitNotCompletingConditionWhenWaitingWithoutTimeoutThenPollingContinuesUntilCompleted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+
+    WaitPolicy waitPolicy;
+    uint32_t checksAfterBlockingWait = 0u;
+    uint32_t blockingWaitCalled = 0u;
+
+    EXPECT_TRUE(waitPolicy.wait([&]() { return blockingWaitCalled && ++checksAfterBlockingWait == 10u; }, [&]() { blockingWaitCalled++; }, false, 0));
+
+    EXPECT_EQ(1u, blockingWaitCalled);
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Yield));
+}
+
+TEST(WaitPolicyTest, givenBlockingWaitDisabledWhenWaitingWithoutTimeoutThenBlockingWaitIsNotCalled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+    DebugManager.flags.EnableWaitPolicyBlockingWait.set(0);
+
+    WaitPolicy waitPolicy;
+    uint32_t checks = 0u;
+    uint32_t blockingWaitCalled = 0u;
+
+    EXPECT_TRUE(waitPolicy.wait([&]() { return ++checks == 100u; }, [&]() { blockingWaitCalled++; }, false, 0));
+
+    EXPECT_EQ(0u, blockingWaitCalled);
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Yield));
+}
+
+TEST(WaitPolicyTest, givenConditionNeverCompletedWhenWaitingWithTimeoutThenFalseIsReturnedWithoutBlockingWait) {
+    WaitPolicy waitPolicy;
+    uint32_t blockingWaitCalled = 0u;
+
+    EXPECT_FALSE(waitPolicy.wait([]() { return false; }, [&]() { blockingWaitCalled++; }, true, 100));
+
+    EXPECT_EQ(0u, blockingWaitCalled);
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Timeout));
+}
+
+TEST(WaitPolicyTest, givenNoBlockingWaitWhenWaitingWithoutTimeoutThenConditionIsPolledUntilCompleted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WaitPolicySpinTimeUs.set(0);
+
+    WaitPolicy waitPolicy;
+    uint32_t checks = 0u;
+
+    EXPECT_TRUE(waitPolicy.wait([&]() { return ++checks == 100u; }, false, 0));
+
+    EXPECT_EQ(100u, checks);
+    EXPECT_EQ(0u, waitPolicy.getWaitCount(WaitPhase::Block));
+    EXPECT_EQ(1u, waitPolicy.getWaitCount(WaitPhase::Yield));
+}